@@ -2,15 +2,160 @@
 // SPDX-FileCopyrightText: 2025 NeoFOAM authors
 #pragma once
 
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include <Kokkos_Core.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_test_case_info.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
+#include <catch2/reporters/catch_reporter_event_listener.hpp>
 #include <catch2/reporters/catch_reporter_registrars.hpp>
 #include <catch2/reporters/catch_reporter_streaming_base.hpp>
 
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/fields/field.hpp"
+
+namespace NeoFOAM::benchmark
+{
+
+/**
+ * @brief The memory traffic and floating point work of a single kernel invocation.
+ */
+struct KernelCost
+{
+    Executor exec; ///< The executor running the kernel.
+    double bytes;  ///< The number of bytes read from and written to memory.
+    double flops;  ///< The number of floating point operations.
+};
+
+/**
+ * @brief The cost declared for the next benchmark.
+ */
+inline std::optional<KernelCost>& pendingCost()
+{
+    static std::optional<KernelCost> cost;
+    return cost;
+}
+
+/**
+ * @brief Declare the cost of the next BENCHMARK, which enables its roofline report.
+ *
+ * The bytes should count the minimal traffic of the algorithm, ie. every input read and every
+ * output written once, so that the reported bandwidth exposes the headroom of the implementation.
+ *
+ * @param exec The executor running the benchmark.
+ * @param bytes The number of bytes moved by a single invocation.
+ * @param flops The number of floating point operations of a single invocation.
+ */
+inline void declareCost(const Executor& exec, double bytes, double flops)
+{
+    pendingCost() = KernelCost {exec, bytes, flops};
+}
+
+/**
+ * @brief Measure the bandwidth of a STREAM triad, a[i] = b[i] + s * c[i], in bytes per second.
+ *
+ * The best of several repetitions is taken and the result is cached per executor.
+ * @param exec The executor to measure the bandwidth of.
+ */
+inline double streamTriadBandwidth(const Executor& exec)
+{
+    static std::map<std::string, double> cache;
+    std::string execName = std::visit([](const auto& e) { return e.name(); }, exec);
+    if (auto it = cache.find(execName); it != cache.end())
+    {
+        return it->second;
+    }
+
+    const size_t size = 1 << 24;
+    const scalar factor = 3.0;
+    Field<scalar> a(exec, size, 0.0);
+    Field<scalar> b(exec, size, 1.0);
+    Field<scalar> c(exec, size, 2.0);
+    auto [spanA, spanB, spanC] = spans(a, b, c);
+
+    double best = std::numeric_limits<double>::max();
+    for (int rep = 0; rep < 10; rep++)
+    {
+        Kokkos::fence();
+        Kokkos::Timer timer;
+        parallelFor(
+            exec,
+            {0, size},
+            KOKKOS_LAMBDA(const size_t i) { spanA[i] = spanB[i] + factor * spanC[i]; },
+            "benchmark::streamTriad"
+        );
+        Kokkos::fence();
+        best = std::min(best, timer.seconds());
+    }
+    return cache[execName] = 3.0 * size * sizeof(scalar) / best;
+}
+
+/**
+ * @brief Reports the achieved bandwidth and flop rate of benchmarks with a declared cost.
+ *
+ * The report is emitted as a Catch2 warning, so that it reaches all reporters, e.g. as a Warning
+ * element inside the BenchmarkResults of the XML reporter, which scripts/catch2json.py reads.
+ */
+class RooflineListener : public Catch::EventListenerBase
+{
+public:
+
+    using Catch::EventListenerBase::EventListenerBase;
+
+    void benchmarkStarting([[maybe_unused]] const Catch::BenchmarkInfo& benchmarkInfo) override
+    {
+        // a cost belongs to the next benchmark only
+        cost_ = pendingCost();
+        pendingCost().reset();
+    }
+
+    void sectionEnded([[maybe_unused]] const Catch::SectionStats& sectionStats) override
+    {
+        // discard a cost declared for a benchmark which did not run, e.g. when it was skipped
+        pendingCost().reset();
+    }
+
+    void benchmarkEnded(const Catch::BenchmarkStats<>& benchmarkStats) override
+    {
+        if (!cost_)
+        {
+            return;
+        }
+        double seconds = benchmarkStats.mean.point.count() * 1e-9;
+        double bandwidth = cost_->bytes / seconds;
+        double peak = streamTriadBandwidth(cost_->exec);
+
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(2) << "roofline [" << benchmarkStats.info.name
+               << "]: " << bandwidth * 1e-9 << " GB/s, " << cost_->flops / seconds * 1e-9
+               << " GFLOP/s, " << 100.0 * bandwidth / peak << " % of STREAM triad ("
+               << peak * 1e-9 << " GB/s)";
+        cost_.reset();
+        // benchmarkEnded is called from within the test case, so the message is reported like a
+        // WARN in the benchmark section
+        WARN(report.str());
+    }
+
+private:
+
+    std::optional<KernelCost> cost_;
+};
+
+CATCH_REGISTER_LISTENER(RooflineListener)
+
+} // namespace NeoFOAM::benchmark
+
 int main(int argc, char* argv[])
 {
     // Initialize Catch2
@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "../catch_main.hpp"
+#include "NeoFOAM/NeoFOAM.hpp"
+
+// These benchmarks measure the fixed cost of launching a kernel, ie. the dispatch on the Executor
+// variant, the Kokkos launch and the fence, which dominates small patches and meshes. Comparing
+// the executors over the sizes gives the size below which serial execution is faster.
+
+/* @brief launch an empty kernel on a concrete executor, nvcc rejects the KOKKOS_LAMBDA inside the
+ * generic lambda of std::visit */
+template<typename ExecutorType>
+void launchEmptyKernel(const ExecutorType& exec)
+{
+    NeoFOAM::parallelFor(exec, {0, 1}, KOKKOS_LAMBDA(const size_t) {}, "emptyKernel");
+    Kokkos::fence();
+}
+
+TEST_CASE("parallelFor::emptyKernel", "[bench]")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("fence")
+    {
+        BENCHMARK(std::string(execName)) { Kokkos::fence(); };
+    }
+
+    SECTION("concrete")
+    {
+        // dispatch on the variant once, outside of the timed region
+        std::visit(
+            [&](const auto& e)
+            {
+                BENCHMARK(std::string(execName)) { launchEmptyKernel(e); };
+            },
+            exec
+        );
+    }
+
+    SECTION("variant")
+    {
+        BENCHMARK(std::string(execName))
+        {
+            NeoFOAM::parallelFor(exec, {0, 1}, KOKKOS_LAMBDA(const size_t) {}, "emptyKernel");
+            Kokkos::fence();
+        };
+    }
+}
+
+TEST_CASE("parallelFor::smallSizes", "[bench]")
+{
+    auto size = GENERATE(1, 10, 100, 1000, 10000);
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    DYNAMIC_SECTION("" << size)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, static_cast<size_t>(size), 1.0);
+        auto span = field.span();
+
+        BENCHMARK(std::string(execName))
+        {
+            NeoFOAM::parallelFor(
+                exec,
+                {0, span.size()},
+                KOKKOS_LAMBDA(const size_t i) { span[i] *= 2.0; },
+                "smallSizes"
+            );
+            Kokkos::fence();
+        };
+    }
+}
+
+TEST_CASE("parallelReduce::smallSizes", "[bench]")
+{
+    auto size = GENERATE(1, 10, 100, 1000, 10000);
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    DYNAMIC_SECTION("" << size)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, static_cast<size_t>(size), 1.0);
+        auto span = field.span();
+
+        BENCHMARK(std::string(execName))
+        {
+            NeoFOAM::scalar sum = 0.0;
+            NeoFOAM::parallelReduce(
+                exec,
+                {0, span.size()},
+                KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& acc) { acc += span[i]; },
+                sum,
+                "smallSizes"
+            );
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("parallelReduce::reproducible", "[bench]")
+{
+    auto size = GENERATE(1 << 10, 1 << 16, 1 << 20);
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    auto mode = GENERATE(NeoFOAM::ReduceMode::fast, NeoFOAM::ReduceMode::reproducible);
+    std::string modeName = mode == NeoFOAM::ReduceMode::fast ? "fast" : "reproducible";
+
+    DYNAMIC_SECTION("" << size << " " << modeName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, static_cast<size_t>(size), 1.0);
+        auto span = field.span();
+
+        BENCHMARK(std::string(execName))
+        {
+            NeoFOAM::scalar sum = 0.0;
+            NeoFOAM::parallelReduce(
+                exec,
+                {0, span.size()},
+                KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& acc) { acc += span[i]; },
+                sum,
+                mode,
+                "reproducible"
+            );
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("parallelFor::imbalanced", "[bench]")
+{
+    auto size = GENERATE(1 << 14, 1 << 18);
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}), NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    // both workloads do the same total work, the imbalanced one only in the first eighth
+    bool balanced = GENERATE(true, false);
+    std::string workName = balanced ? "balanced" : "imbalanced";
+
+    DYNAMIC_SECTION("" << size << " " << workName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, static_cast<size_t>(size), 1.0);
+        auto span = field.span();
+        const size_t heavy = span.size() / 8;
+
+        BENCHMARK(std::string(execName))
+        {
+            NeoFOAM::parallelFor(
+                exec,
+                {0, span.size()},
+                KOKKOS_LAMBDA(const size_t i) {
+                    const size_t nIter = balanced ? 32 : (i < heavy ? 256 : 0);
+                    NeoFOAM::scalar value = span[i];
+                    for (size_t k = 0; k < nIter; k++)
+                    {
+                        value = 0.5 * value + 1.0;
+                    }
+                    span[i] = value;
+                },
+                "imbalanced"
+            );
+            Kokkos::fence();
+        };
+    }
+}
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "../catch_main.hpp"
+#include "NeoFOAM/NeoFOAM.hpp"
+#include "NeoFOAM/core/parallelPrimitives.hpp"
+
+// keys in [0, nBins) in a scattered order, like the cell indices of the faces of a mesh
+NeoFOAM::Field<NeoFOAM::label> scatteredKeys(const NeoFOAM::Executor& exec, size_t size)
+{
+    std::vector<NeoFOAM::label> keys(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        keys[i] = static_cast<NeoFOAM::label>((i * 7919) % (size / 4 + 1));
+    }
+    return NeoFOAM::Field<NeoFOAM::label>(exec, keys);
+}
+
+TEST_CASE("parallelPrimitives", "[bench]")
+{
+    auto size = GENERATE(1 << 16, 1 << 20);
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    const auto keys = scatteredKeys(exec, static_cast<size_t>(size));
+
+    DYNAMIC_SECTION("sortByKey " << size)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> values(exec, keys.size(), 1.0);
+        BENCHMARK_ADVANCED(std::string(execName))(Catch::Benchmark::Chronometer meter)
+        {
+            NeoFOAM::Field<NeoFOAM::label> sorted(keys);
+            meter.measure(
+                [&]
+                {
+                    NeoFOAM::sortByKey(sorted, values);
+                    Kokkos::fence();
+                }
+            );
+        };
+    }
+
+    DYNAMIC_SECTION("copyIf " << size)
+    {
+        BENCHMARK(std::string(execName))
+        {
+            auto even =
+                NeoFOAM::copyIf(keys, KOKKOS_LAMBDA(const NeoFOAM::label k) { return k % 2 == 0; });
+            Kokkos::fence();
+            return even.size();
+        };
+    }
+
+    DYNAMIC_SECTION("histogram " << size)
+    {
+        BENCHMARK(std::string(execName))
+        {
+            auto counts = NeoFOAM::histogram(keys, keys.size() / 4 + 1);
+            Kokkos::fence();
+            return counts.size();
+        };
+    }
+}
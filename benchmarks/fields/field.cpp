@@ -26,6 +26,8 @@ TEST_CASE("Field<scalar>::addition", "[bench]")
         NeoFOAM::Field<NeoFOAM::scalar> cpuC(exec, size);
         NeoFOAM::fill(cpuC, 0.0);
 
+        // two reads and one write per element
+        NeoFOAM::benchmark::declareCost(exec, 3.0 * size * sizeof(NeoFOAM::scalar), size);
         BENCHMARK(std::string(execName)) { return (cpuC = cpuA + cpuB); };
     }
 }
@@ -50,6 +52,56 @@ TEST_CASE("Field<scalar>::multiplication", "[bench]")
         NeoFOAM::Field<NeoFOAM::scalar> cpuC(exec, size);
         NeoFOAM::fill(cpuC, 0.0);
 
+        // two reads and one write per element
+        NeoFOAM::benchmark::declareCost(exec, 3.0 * size * sizeof(NeoFOAM::scalar), size);
         BENCHMARK(std::string(execName)) { return (cpuC = cpuA * cpuB); };
     }
 }
+
+TEST_CASE("Field<scalar>::copyToHost", "[bench]")
+{
+    auto size = GENERATE(1 << 16, 1 << 18, 1 << 20);
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    DYNAMIC_SECTION("" << size)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, size, 1.0);
+        NeoFOAM::Field<NeoFOAM::scalar> hostField(NeoFOAM::SerialExecutor {}, size);
+
+        // one read and one write per element
+        NeoFOAM::benchmark::declareCost(exec, 2.0 * size * sizeof(NeoFOAM::scalar), 0);
+        BENCHMARK(execName + "-copyToHost") { return field.copyToHost(); };
+
+        // the host field and the staging buffer are reused
+        NeoFOAM::benchmark::declareCost(exec, 2.0 * size * sizeof(NeoFOAM::scalar), 0);
+        BENCHMARK(execName + "-copyAsync") { NeoFOAM::copyAsync(field, hostField).wait(); };
+    }
+}
+
+TEST_CASE("Field<scalar>::comparison", "[bench]")
+{
+    auto size = GENERATE(1 << 16, 1 << 18, 1 << 20);
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    DYNAMIC_SECTION("" << size)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> a(exec, size, 1.0);
+        NeoFOAM::Field<NeoFOAM::scalar> b(exec, size, 1.0);
+
+        BENCHMARK(execName + "-equal") { return equal(a, b); };
+        BENCHMARK(execName + "-maxDeviation") { return NeoFOAM::maxDeviation(a, b).value; };
+        BENCHMARK(execName + "-checksum") { return NeoFOAM::checksum(a); };
+    }
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoFOAM/NeoFOAM.hpp"
+#include "../../../catch_main.hpp"
+
+TEST_CASE("SurfaceInterpolation::linear", "[bench]")
+{
+    auto size = GENERATE(1 << 16, 1 << 18, 1 << 20);
+    auto precision = GENERATE(NeoFOAM::Precision::full, NeoFOAM::Precision::reduced);
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    std::string precisionName = precision == NeoFOAM::Precision::full ? "full" : "reduced";
+    NeoFOAM::UnstructuredMesh mesh = NeoFOAM::create1DUniformMesh(exec, size);
+    fvcc::GeometryScheme::readOrCreate(mesh)->setWeightsPrecision(precision);
+
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoFOAM::scalar>>(mesh);
+    fvcc::VolumeField<NeoFOAM::scalar> phi(exec, "phi", mesh, volumeBCs);
+    NeoFOAM::fill(phi.internalField(), 1.0);
+    NeoFOAM::fill(phi.boundaryField().value(), 1.0);
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoFOAM::scalar>>(mesh);
+    fvcc::SurfaceField<NeoFOAM::scalar> phif(exec, "phif", mesh, surfaceBCs);
+
+    // capture the value of size as section name
+    DYNAMIC_SECTION("" << size)
+    {
+        NeoFOAM::Input input = NeoFOAM::TokenList({std::string("linear")});
+        fvcc::SurfaceInterpolation<NeoFOAM::scalar> interpolation(exec, mesh, input);
+
+        // minimal traffic: weight, owner, neighbour and result of each face and phi of each cell,
+        // the weight is read in the storage type. The interpolation takes 3 flops per face.
+        const size_t weightBytes = precision == NeoFOAM::Precision::full
+                                     ? sizeof(NeoFOAM::scalar)
+                                     : sizeof(NeoFOAM::ReducedType<NeoFOAM::scalar>);
+        const double nFaces = static_cast<double>(mesh.nFaces());
+        const double nCells = static_cast<double>(mesh.nCells());
+        NeoFOAM::benchmark::declareCost(
+            exec,
+            nFaces * (sizeof(NeoFOAM::scalar) + weightBytes + 2 * sizeof(NeoFOAM::label))
+                + nCells * sizeof(NeoFOAM::scalar),
+            3 * nFaces
+        );
+        BENCHMARK(execName + "-" + precisionName)
+        {
+            return (interpolation.interpolate(phi, phif));
+        };
+    }
+}
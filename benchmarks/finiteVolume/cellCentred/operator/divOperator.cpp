@@ -7,7 +7,7 @@
 #include "NeoFOAM/NeoFOAM.hpp"
 #include "../../../catch_main.hpp"
 
-using Operator = NeoFOAM::dsl::Operator;
+using Operator = NeoFOAM::dsl::Operator<NeoFOAM::scalar>;
 
 TEST_CASE("DivOperator::div", "[bench]")
 {
@@ -36,6 +36,66 @@ TEST_CASE("DivOperator::div", "[bench]")
         NeoFOAM::Input input = NeoFOAM::TokenList({std::string("Gauss"), std::string("linear")});
         auto op = fvcc::DivOperator(Operator::Type::Explicit, faceFlux, phi, input);
 
+        // minimal traffic: flux, weight, owner and neighbour of each face, and phi, volume and
+        // the result of each cell. Interpolation and flux summation take 7 flops per face, the
+        // scaling by the volume 2 flops per cell.
+        const double nFaces = static_cast<double>(mesh.nInternalFaces());
+        const double nCells = static_cast<double>(mesh.nCells());
+        NeoFOAM::benchmark::declareCost(
+            exec,
+            nFaces * (2 * sizeof(NeoFOAM::scalar) + 2 * sizeof(NeoFOAM::label))
+                + nCells * 3 * sizeof(NeoFOAM::scalar),
+            7 * nFaces + 2 * nCells
+        );
         BENCHMARK(std::string(execName)) { return (op.div(divPhi)); };
     }
 }
+
+TEST_CASE("DivOperator::div::precision", "[bench]")
+{
+    auto size = GENERATE(1 << 18, 1 << 20);
+    auto precision = GENERATE(NeoFOAM::Precision::full, NeoFOAM::Precision::reduced);
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    std::string precisionName = precision == NeoFOAM::Precision::full ? "full" : "reduced";
+    NeoFOAM::UnstructuredMesh mesh = NeoFOAM::create1DUniformMesh(exec, size);
+    // read the interpolation weights and the cell volumes in the selected precision
+    mesh.setPrecision(NeoFOAM::GeometryArray::cellVolumes, precision);
+    fvcc::GeometryScheme::readOrCreate(mesh)->setWeightsPrecision(precision);
+
+    auto surfaceBCs = fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoFOAM::scalar>>(mesh);
+    fvcc::SurfaceField<NeoFOAM::scalar> faceFlux(exec, "sf", mesh, surfaceBCs);
+    NeoFOAM::fill(faceFlux.internalField(), 1.0);
+
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoFOAM::scalar>>(mesh);
+    fvcc::VolumeField<NeoFOAM::scalar> phi(exec, "vf", mesh, volumeBCs);
+    fvcc::VolumeField<NeoFOAM::scalar> divPhi(exec, "divPhi", mesh, volumeBCs);
+    NeoFOAM::fill(phi.internalField(), 1.0);
+
+    // capture the value of size as section name
+    DYNAMIC_SECTION("" << size)
+    {
+        NeoFOAM::Input input = NeoFOAM::TokenList({std::string("Gauss"), std::string("linear")});
+        auto op = fvcc::DivOperator(Operator::Type::Explicit, faceFlux, phi, input);
+
+        // the traffic of DivOperator::div with the weight and the volume in the storage type
+        const size_t geometryBytes = precision == NeoFOAM::Precision::full
+                                       ? sizeof(NeoFOAM::scalar)
+                                       : sizeof(NeoFOAM::ReducedType<NeoFOAM::scalar>);
+        const double nFaces = static_cast<double>(mesh.nInternalFaces());
+        const double nCells = static_cast<double>(mesh.nCells());
+        NeoFOAM::benchmark::declareCost(
+            exec,
+            nFaces * (sizeof(NeoFOAM::scalar) + geometryBytes + 2 * sizeof(NeoFOAM::label))
+                + nCells * (2 * sizeof(NeoFOAM::scalar) + geometryBytes),
+            7 * nFaces + 2 * nCells
+        );
+        BENCHMARK(execName + "-" + precisionName) { return (op.div(divPhi)); };
+    }
+}
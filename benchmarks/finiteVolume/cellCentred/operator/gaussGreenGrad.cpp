@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "NeoFOAM/NeoFOAM.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
+#include "../../../catch_main.hpp"
+
+TEST_CASE("GaussGreenGrad::grad", "[bench]")
+{
+    auto size = GENERATE(1 << 16, 1 << 18, 1 << 20);
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    NeoFOAM::UnstructuredMesh mesh = NeoFOAM::create1DUniformMesh(exec, size);
+
+    auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoFOAM::scalar>>(mesh);
+    fvcc::VolumeField<NeoFOAM::scalar> phi(exec, "phi", mesh, volumeBCs);
+    NeoFOAM::fill(phi.internalField(), 1.0);
+    NeoFOAM::fill(phi.boundaryField().value(), 1.0);
+    auto vectorBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoFOAM::Vector>>(mesh);
+    fvcc::VolumeField<NeoFOAM::Vector> gradPhi(exec, "gradPhi", mesh, vectorBCs);
+
+    // capture the value of size as section name
+    DYNAMIC_SECTION("" << size)
+    {
+        fvcc::GaussGreenGrad grad(exec, mesh);
+
+        // minimal traffic: face area, interpolated value, owner and neighbour of each face, and
+        // volume and result of each cell. The face fluxes take 3 flops per face and 6 for the
+        // summation, the scaling by the volume 4 flops per cell.
+        const double nFaces = static_cast<double>(mesh.nInternalFaces());
+        const double nCells = static_cast<double>(mesh.nCells());
+        NeoFOAM::benchmark::declareCost(
+            exec,
+            nFaces * (4 * sizeof(NeoFOAM::scalar) + 2 * sizeof(NeoFOAM::label))
+                + nCells * 4 * sizeof(NeoFOAM::scalar),
+            9 * nFaces + 4 * nCells
+        );
+        BENCHMARK(std::string(execName)) { return (grad.grad(phi, gradPhi)); };
+    }
+}
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+
+#include "../catch_main.hpp"
+#include "NeoFOAM/NeoFOAM.hpp"
+
+// An explicit advection diffusion of a scalar T in the unit cube
+//
+//     ddt(T) + div(phi, T) - gamma laplacian(T) = 0
+//
+// with a uniform velocity in x direction, T = 1 on the inlet and zero gradient elsewhere.
+// Each time step runs the full stack of a solver, ie. the dsl expression, the time integration
+// and the boundary correction, and the throughput in cells/s is what capacity planning is based on.
+// Configure with -DNEOFOAM_ENABLE_PROFILING=ON to break the time step down into its phases.
+// The replay of the step from a KernelGraph gives the time of its kernels alone.
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+using Operator = NeoFOAM::dsl::Operator<NeoFOAM::scalar>;
+using VolumeField = fvcc::VolumeField<NeoFOAM::scalar>;
+
+/* An explicit laplacian for orthogonal meshes, the library does not provide one yet */
+class Laplacian : public NeoFOAM::dsl::OperatorMixin<VolumeField>
+{
+
+public:
+
+    Laplacian(VolumeField& field) : OperatorMixin(field.exec(), field, Operator::Type::Explicit) {}
+
+    void explicitOperation(NeoFOAM::Field<NeoFOAM::scalar>& source)
+    {
+        const auto& mesh = field_.mesh();
+        const auto& bMesh = mesh.boundaryMesh();
+        NeoFOAM::Field<NeoFOAM::scalar> lap(source.exec(), source.size(), 0.0);
+        auto lapSpan = lap.span();
+        const auto T = field_.internalField().span();
+        const auto Tb = field_.boundaryField().value().span();
+        const auto owner = mesh.faceOwner().span();
+        const auto neighbour = mesh.faceNeighbour().span();
+        const auto magSf = mesh.magFaceAreas().span();
+        const auto C = mesh.cellCentres().span();
+        const auto faceCells = bMesh.faceCells().span();
+        const auto bMagSf = bMesh.magSf().span();
+        const auto bDeltaCoeffs = bMesh.deltaCoeffs().span();
+        const auto V = mesh.cellVolumes().span();
+
+        NeoFOAM::parallelFor(
+            source.exec(),
+            {0, mesh.nInternalFaces()},
+            KOKKOS_LAMBDA(const size_t i) {
+                auto own = static_cast<size_t>(owner[i]);
+                auto nei = static_cast<size_t>(neighbour[i]);
+                NeoFOAM::scalar flux = magSf[i] * (T[nei] - T[own]) / mag(C[nei] - C[own]);
+                Kokkos::atomic_add(&lapSpan[own], flux);
+                Kokkos::atomic_sub(&lapSpan[nei], flux);
+            },
+            "laplacian::internalFaces"
+        );
+        NeoFOAM::parallelFor(
+            source.exec(),
+            {0, mesh.nBoundaryFaces()},
+            KOKKOS_LAMBDA(const size_t i) {
+                auto own = static_cast<size_t>(faceCells[i]);
+                Kokkos::atomic_add(&lapSpan[own], bMagSf[i] * (Tb[i] - T[own]) * bDeltaCoeffs[i]);
+            },
+            "laplacian::boundaryFaces"
+        );
+
+        auto sourceSpan = source.span();
+        auto coeff = getCoefficient();
+        NeoFOAM::parallelFor(
+            source.exec(),
+            source.range(),
+            KOKKOS_LAMBDA(const size_t i) { sourceSpan[i] += coeff[i] * lapSpan[i] / V[i]; },
+            "laplacian::scaleByVolume"
+        );
+    }
+
+    std::string getName() const { return "Laplacian"; }
+};
+
+struct CreateField
+{
+    std::string name;
+    const NeoFOAM::UnstructuredMesh& mesh;
+
+    NeoFOAM::Document operator()(NeoFOAM::Database& db)
+    {
+        // inlet at the left patch, zero gradient on all other patches
+        std::vector<fvcc::VolumeBoundary<NeoFOAM::scalar>> bcs {};
+        for (size_t patchi = 0; patchi < mesh.nBoundaries(); patchi++)
+        {
+            NeoFOAM::Dictionary dict;
+            if (patchi == 0)
+            {
+                dict.insert("type", std::string("fixedValue"));
+                dict.insert("fixedValue", 1.0);
+            }
+            else
+            {
+                dict.insert("type", std::string("fixedGradient"));
+                dict.insert("fixedGradient", 0.0);
+            }
+            bcs.push_back(fvcc::VolumeBoundary<NeoFOAM::scalar>(mesh, dict, patchi));
+        }
+        NeoFOAM::Field<NeoFOAM::scalar> internalField(mesh.exec(), mesh.nCells(), 0.0);
+        VolumeField vf(mesh.exec(), name, mesh, internalField, bcs, db, "", "");
+        return NeoFOAM::Document(
+            {{"name", vf.name},
+             {"timeIndex", std::int64_t(0)},
+             {"iterationIndex", std::int64_t(0)},
+             {"subCycleIndex", std::int64_t(0)},
+             {"field", vf}},
+            fvcc::validateFieldDoc
+        );
+    }
+};
+
+TEST_CASE("scalarTransport", "[bench]")
+{
+    auto n = GENERATE(16, 32, 64);
+
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    const auto nCells = static_cast<size_t>(n * n * n);
+    NeoFOAM::UnstructuredMesh mesh = NeoFOAM::create3DUniformMesh(
+        exec, static_cast<size_t>(n), static_cast<size_t>(n), static_cast<size_t>(n)
+    );
+
+    NeoFOAM::Database db;
+    fvcc::FieldCollection& fieldCollection = fvcc::FieldCollection::instance(db, "fieldCollection");
+    VolumeField& T = fieldCollection.registerField<VolumeField>(CreateField {"T", mesh});
+    T.correctBoundaryConditions();
+
+    // uniform velocity U = (1, 0, 0), ie. the face flux is the x component of the face area
+    fvcc::SurfaceField<NeoFOAM::scalar> phi(
+        exec, "phi", mesh, fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoFOAM::scalar>>(mesh)
+    );
+    const auto Sf = mesh.faceAreas().span();
+    NeoFOAM::parallelFor(
+        phi.internalField(), KOKKOS_LAMBDA(const size_t i) { return Sf[i][0]; }
+    );
+
+    NeoFOAM::Dictionary fvSchemes;
+    NeoFOAM::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("forwardEuler"));
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoFOAM::Dictionary divSchemes;
+    divSchemes.insert("div(phi,T)", NeoFOAM::TokenList({std::string("Gauss"), std::string("linear")}));
+    fvSchemes.insert("divSchemes", divSchemes);
+    NeoFOAM::Dictionary fvSolution;
+
+    const NeoFOAM::scalar gamma = 0.01;
+    const NeoFOAM::scalar h = 1.0 / n;
+    // stay below the advective and diffusive stability limits
+    const NeoFOAM::scalar dt = 0.5 * std::min(h, h * h / (6 * gamma));
+    NeoFOAM::scalar time = 0.0;
+
+    auto eqn = NeoFOAM::dsl::temporal::ddt(T) + NeoFOAM::dsl::exp::div(phi, T)
+             - gamma * Operator(Laplacian(T));
+
+    // capture the number of cells as section name
+    DYNAMIC_SECTION("" << nCells)
+    {
+        BENCHMARK(std::string(execName))
+        {
+            NeoFOAM::dsl::solve(eqn, T, time, dt, fvSchemes, fvSolution);
+            time += dt;
+            // the last kernels of the step run asynchronously on devices
+            Kokkos::fence();
+        };
+
+        // replaying the kernels of a captured step skips the host code, so the difference to the
+        // benchmark above is the host overhead per step
+        NeoFOAM::KernelGraph step;
+        step.capture([&]() { NeoFOAM::dsl::solve(eqn, T, time, dt, fvSchemes, fvSolution); });
+        step.track(T.internalField());
+        REQUIRE(step.replayable());
+        BENCHMARK(execName + "-replay")
+        {
+            step.replay();
+            Kokkos::fence();
+        };
+        step.clear();
+
+        // time a fixed number of steps with the profiler to break the step down into its phases
+        const size_t nSteps = 10;
+        auto& profiler = NeoFOAM::profiling::Profiler::instance();
+        profiler.reset();
+        profiler.setFence(true);
+        for (size_t step = 0; step < nSteps; step++)
+        {
+            NeoFOAM::profiling::ScopedTimer timer("timeStep");
+            NeoFOAM::dsl::solve(eqn, T, time, dt, fvSchemes, fvSolution);
+            time += dt;
+        }
+        profiler.setFence(false);
+
+        // report through Catch2, so that the figures reach the xml results and the json records
+        // of scripts/catch2json.py
+        std::ostringstream report;
+        for (const auto& region : profiler.stats())
+        {
+            const double perStep = region.total / static_cast<double>(nSteps);
+            if (region.path == "timeStep")
+            {
+                report << "throughput [" << execName << "]: " << perStep * 1e3 << " ms/step, "
+                       << static_cast<double>(nCells) / perStep << " cells/s\n";
+            }
+            else
+            {
+                report << "phase [" << execName << "] " << region.path << ": " << perStep * 1e3
+                       << " ms/step\n";
+            }
+        }
+        WARN(report.str());
+        profiler.reset();
+    }
+}
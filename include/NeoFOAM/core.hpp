@@ -6,10 +6,12 @@
 #include "core/error.hpp"
 #include "core/info.hpp"
 #include "core/input.hpp"
+#include "core/kernelGraph.hpp"
 #include "core/parallelAlgorithms.hpp"
 #include "core/runtimeSelectionFactory.hpp"
 #include "core/time.hpp"
 #include "core/tokenList.hpp"
+#include "core/primitives/batch.hpp"
 #include "core/primitives/label.hpp"
 #include "core/primitives/scalar.hpp"
 #include "core/primitives/vector.hpp"
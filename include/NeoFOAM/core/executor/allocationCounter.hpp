@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief The number of allocations and deallocations and the bytes they moved.
+ */
+struct AllocationStats
+{
+    size_t nAllocations {0};   ///< The number of allocations, a reallocation counts as one.
+    size_t nFrees {0};         ///< The number of deallocations, a reallocation counts as one.
+    size_t bytesAllocated {0}; ///< The number of bytes allocated.
+    size_t bytesFreed {0};     ///< The number of bytes freed.
+    size_t nHugePages {0};     ///< The number of allocations backed by huge pages.
+    size_t bytesHugePages {0}; ///< The number of bytes allocated backed by huge pages.
+    size_t nRealigned {0};     ///< The number of allocations padded to meet the alignment.
+
+    AllocationStats& operator+=(const AllocationStats& rhs);
+};
+
+/**
+ * @brief How an allocation was served according to the AllocationPolicy of the executor.
+ */
+struct AllocationTraits
+{
+    bool hugePages {false}; ///< The memory is backed by transparent or explicit huge pages.
+    bool realigned {false}; ///< The memory was padded to meet the requested alignment.
+};
+
+/**
+ * @class AllocationCounter
+ * @brief Counts the allocations of all executors, grouped by the label of the allocation.
+ *
+ * Counting is disabled by default, in which case the executors only pay for checking a flag.
+ * Once enabled, every alloc, realloc and free of the executors is recorded, which allows tests to
+ * hold code that runs every time step to a fixed allocation budget, see countAllocations.
+ * Memory allocated before counting was enabled is not counted when it is freed.
+ */
+class AllocationCounter
+{
+public:
+
+    /**
+     * @brief Get the process wide allocation counter.
+     */
+    static AllocationCounter& instance();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    /**
+     * @brief Enable or disable counting.
+     */
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+
+    /**
+     * @brief Check if allocations are counted.
+     */
+    bool enabled() const { return enabled_; }
+
+    /**
+     * @brief Record an allocation.
+     * @param ptr The allocated memory.
+     * @param bytes The size of the allocation in bytes.
+     * @param label The label of the allocation.
+     * @param traits How the allocation was served.
+     */
+    void recordAlloc(
+        void* ptr, size_t bytes, const std::string& label, AllocationTraits traits = {}
+    );
+
+    /**
+     * @brief Record a reallocation as a free of the old memory and an allocation of the new.
+     * @param oldPtr The memory before the reallocation.
+     * @param newPtr The memory after the reallocation.
+     * @param bytes The new size in bytes.
+     * @param traits How the new allocation was served.
+     */
+    void recordRealloc(void* oldPtr, void* newPtr, size_t bytes, AllocationTraits traits = {});
+
+    /**
+     * @brief Record a deallocation, a nullptr or memory not allocated while counting is ignored.
+     * @param ptr The memory to be freed.
+     */
+    void recordFree(void* ptr);
+
+    /**
+     * @brief Get the statistics of all labels combined.
+     */
+    AllocationStats total() const;
+
+    /**
+     * @brief Get the statistics of a single label.
+     */
+    AllocationStats stats(const std::string& label) const;
+
+    /**
+     * @brief Get the statistics of each label.
+     */
+    std::map<std::string, AllocationStats> statsPerLabel() const;
+
+    /**
+     * @brief Reset the statistics, the sizes of live allocations are kept to record their free.
+     */
+    void reset();
+
+    /**
+     * @brief Print the statistics of each label as a table.
+     * @param out The stream to print to.
+     */
+    void print(std::ostream& out = std::cout) const;
+
+private:
+
+    AllocationCounter() = default;
+
+    struct Allocation
+    {
+        size_t bytes;
+        std::string label;
+    };
+
+    std::atomic<bool> enabled_ {false};
+    mutable std::mutex mutex_;
+    std::map<std::string, AllocationStats> stats_;
+    std::unordered_map<void*, Allocation> live_;
+};
+
+/**
+ * @brief Record an allocation of an executor if counting is enabled.
+ * @return The allocated memory.
+ */
+inline void*
+countAlloc(void* ptr, size_t bytes, const std::string& label, AllocationTraits traits = {})
+{
+    auto& counter = AllocationCounter::instance();
+    if (counter.enabled())
+    {
+        counter.recordAlloc(ptr, bytes, label, traits);
+    }
+    return ptr;
+}
+
+/**
+ * @brief Record a reallocation of an executor if counting is enabled.
+ * @return The reallocated memory.
+ */
+inline void*
+countRealloc(void* oldPtr, void* newPtr, size_t bytes, AllocationTraits traits = {})
+{
+    auto& counter = AllocationCounter::instance();
+    if (counter.enabled())
+    {
+        counter.recordRealloc(oldPtr, newPtr, bytes, traits);
+    }
+    return newPtr;
+}
+
+/**
+ * @brief Record a deallocation of an executor if counting is enabled.
+ */
+inline void countFree(void* ptr)
+{
+    auto& counter = AllocationCounter::instance();
+    if (counter.enabled())
+    {
+        counter.recordFree(ptr);
+    }
+}
+
+/**
+ * @brief Run a number of steps and count the allocations of each of them.
+ *
+ * Counting is enabled for the duration of the call and restored afterwards. A typical use is to
+ * hold the steady state of a solver to an allocation budget:
+ * @code
+ * auto steps = countAllocations(10, [&]() { solve(eqn, vf, t, dt, fvSchemes, fvSolution); });
+ * REQUIRE(maxAllocationsPerStep(steps, 1) <= budget); // skip the first, warm-up step
+ * @endcode
+ *
+ * @param nSteps The number of steps to run.
+ * @param step The callable performing a single step.
+ * @return The statistics of each step.
+ */
+template<typename StepFunction>
+std::vector<AllocationStats> countAllocations(size_t nSteps, StepFunction step)
+{
+    auto& counter = AllocationCounter::instance();
+    bool wasEnabled = counter.enabled();
+    counter.setEnabled(true);
+    std::vector<AllocationStats> result;
+    result.reserve(nSteps);
+    for (size_t i = 0; i < nSteps; i++)
+    {
+        counter.reset();
+        step();
+        result.push_back(counter.total());
+    }
+    counter.setEnabled(wasEnabled);
+    return result;
+}
+
+/**
+ * @brief Get the largest number of allocations of a single step.
+ * @param steps The statistics of each step as returned by countAllocations.
+ * @param skip The number of leading steps to ignore, e.g. to exclude the warm-up.
+ */
+inline size_t maxAllocationsPerStep(const std::vector<AllocationStats>& steps, size_t skip = 0)
+{
+    size_t result = 0;
+    for (size_t i = skip; i < steps.size(); i++)
+    {
+        result = std::max(result, steps[i].nAllocations);
+    }
+    return result;
+}
+
+} // namespace NeoFOAM
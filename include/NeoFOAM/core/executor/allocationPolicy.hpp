@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/executor/allocationCounter.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief The kind of pages backing large host allocations.
+ */
+enum class HugePages
+{
+    none,        ///< Use the default pages of the system.
+    transparent, ///< Advise the kernel to back the memory with transparent huge pages.
+    hugetlbfs    ///< Map the memory from the hugetlbfs pool, transparent if the pool is exhausted.
+};
+
+/**
+ * @brief Alignment and page size of the allocations of an executor.
+ *
+ * Huge pages reduce the TLB misses of the indirect accesses in face loops of large meshes, they
+ * are only used for memory accessible from the host and allocations of at least
+ * hugePageThreshold bytes.
+ */
+struct AllocationPolicy
+{
+    size_t alignment {64};                       ///< The alignment in bytes, a power of two.
+    HugePages hugePages {HugePages::none};       ///< The pages backing large allocations.
+    size_t hugePageThreshold {size_t {1} << 22}; ///< The smallest allocation using huge pages.
+};
+
+namespace detail
+{
+
+template<typename ExecutorType>
+AllocationPolicy& allocationPolicy()
+{
+    static AllocationPolicy policy;
+    return policy;
+}
+
+/**
+ * @class PolicyAllocations
+ * @brief Keeps track of the allocations which do not start at the memory returned by Kokkos.
+ *
+ * These are the allocations padded to meet the alignment and those mapped from hugetlbfs. As
+ * long as there are none, freeing memory only checks an atomic counter.
+ */
+class PolicyAllocations
+{
+public:
+
+    struct Allocation
+    {
+        void* base;   ///< The memory to release.
+        size_t bytes; ///< The size requested by the user.
+        bool mapped;  ///< The memory was mapped from hugetlbfs instead of allocated by Kokkos.
+    };
+
+    static PolicyAllocations& instance();
+
+    void insert(void* ptr, Allocation allocation);
+
+    /**
+     * @brief Remove an allocation, returns nothing if ptr was allocated by Kokkos directly.
+     */
+    std::optional<Allocation> extract(void* ptr);
+
+    /**
+     * @brief Get the size of an allocation, returns nothing if ptr was allocated by Kokkos
+     * directly.
+     */
+    std::optional<size_t> bytes(void* ptr) const;
+
+private:
+
+    PolicyAllocations() = default;
+
+    std::atomic<size_t> size_ {0};
+    mutable std::mutex mutex_;
+    std::unordered_map<void*, Allocation> allocations_;
+};
+
+/**
+ * @brief Map memory from the hugetlbfs pool, returns nullptr if the pool is exhausted.
+ */
+void* mapHugePages(size_t bytes);
+
+/**
+ * @brief Release memory returned by mapHugePages.
+ */
+void unmapHugePages(void* ptr, size_t bytes);
+
+/**
+ * @brief Advise the kernel to back the huge page aligned part of the memory by huge pages.
+ * @return True if the advice was accepted.
+ */
+bool adviseHugePages(void* ptr, size_t bytes);
+
+template<typename ExecSpace>
+constexpr bool onHost =
+    Kokkos::SpaceAccessibility<Kokkos::HostSpace, typename ExecSpace::memory_space>::accessible;
+
+inline bool isAligned(const void* ptr, size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+
+/**
+ * @brief Allocate memory in the memory space of ExecSpace according to the policy.
+ * @return The memory and how it was served.
+ */
+template<typename ExecSpace>
+std::pair<void*, AllocationTraits>
+allocate(size_t size, const std::string& label, const AllocationPolicy& policy)
+{
+    AllocationTraits traits;
+    [[maybe_unused]] bool useHugePages = false;
+    if constexpr (onHost<ExecSpace>)
+    {
+        useHugePages = policy.hugePages != HugePages::none && size >= policy.hugePageThreshold;
+        if (useHugePages && policy.hugePages == HugePages::hugetlbfs)
+        {
+            if (void* ptr = mapHugePages(size))
+            {
+                PolicyAllocations::instance().insert(ptr, {ptr, size, true});
+                traits.hugePages = true;
+                return {ptr, traits};
+            }
+        }
+    }
+
+    void* ptr = Kokkos::kokkos_malloc<ExecSpace>(label, size);
+    if (ptr != nullptr && !isAligned(ptr, policy.alignment))
+    {
+        Kokkos::kokkos_free<ExecSpace>(ptr);
+        void* base = Kokkos::kokkos_malloc<ExecSpace>(label, size + policy.alignment);
+        if (base == nullptr)
+        {
+            return {nullptr, traits};
+        }
+        auto address = reinterpret_cast<std::uintptr_t>(base);
+        ptr = reinterpret_cast<void*>(address + policy.alignment - address % policy.alignment);
+        PolicyAllocations::instance().insert(ptr, {base, size, false});
+        traits.realigned = true;
+    }
+
+    if constexpr (onHost<ExecSpace>)
+    {
+        if (useHugePages)
+        {
+            traits.hugePages = adviseHugePages(ptr, size);
+        }
+    }
+    return {ptr, traits};
+}
+
+/**
+ * @brief A deallocation which is postponed, e.g. while a KernelGraph is captured.
+ */
+struct DeferredFree
+{
+    void* ptr;
+    void (*deallocate)(void*) noexcept;
+};
+
+/**
+ * @brief The list collecting the deallocations of the calling thread, memory is freed right away
+ * if it is not set.
+ */
+inline std::vector<DeferredFree>*& deferredFrees()
+{
+    static thread_local std::vector<DeferredFree>* frees = nullptr;
+    return frees;
+}
+
+/**
+ * @brief Free memory returned by allocate or reallocate.
+ */
+template<typename ExecSpace>
+void deallocate(void* ptr) noexcept
+{
+    if (auto* frees = deferredFrees(); frees != nullptr && ptr != nullptr)
+    {
+        // recorded kernels may still reference the memory
+        frees->push_back({ptr, &deallocate<ExecSpace>});
+        return;
+    }
+    if (auto allocation = PolicyAllocations::instance().extract(ptr))
+    {
+        if (allocation->mapped)
+        {
+            unmapHugePages(allocation->base, allocation->bytes);
+        }
+        else
+        {
+            Kokkos::kokkos_free<ExecSpace>(allocation->base);
+        }
+        return;
+    }
+    Kokkos::kokkos_free<ExecSpace>(ptr);
+}
+
+/**
+ * @brief Get the size of memory returned by Kokkos::kokkos_malloc.
+ */
+template<typename ExecSpace>
+size_t allocationSize(void* ptr)
+{
+    using Record = Kokkos::Impl::SharedAllocationRecord<typename ExecSpace::memory_space, void>;
+    return ptr == nullptr ? 0 : Record::get_record(ptr)->size();
+}
+
+/**
+ * @brief Resize memory returned by allocate according to the policy, the content is kept.
+ * @return The memory and how it was served.
+ */
+template<typename ExecSpace>
+std::pair<void*, AllocationTraits>
+reallocate(void* ptr, size_t newSize, const AllocationPolicy& policy)
+{
+    using View = Kokkos::View<char*, typename ExecSpace::memory_space, Kokkos::MemoryUnmanaged>;
+    auto copyAndFree = [&](void* src, size_t bytes)
+    {
+        auto [dst, traits] = allocate<ExecSpace>(newSize, "Field", policy);
+        auto n = std::min(bytes, newSize);
+        Kokkos::deep_copy(View(static_cast<char*>(dst), n), View(static_cast<char*>(src), n));
+        deallocate<ExecSpace>(src);
+        return std::pair {dst, traits};
+    };
+
+    if (auto bytes = PolicyAllocations::instance().bytes(ptr))
+    {
+        return copyAndFree(ptr, *bytes);
+    }
+    const bool hugePages = onHost<ExecSpace> && policy.hugePages != HugePages::none
+                        && newSize >= policy.hugePageThreshold;
+    // the huge page buffer is allocated right away, so the content is copied only once, and while
+    // a KernelGraph is captured the old memory has to outlive the graph, which kokkos_realloc frees
+    if (hugePages || deferredFrees() != nullptr)
+    {
+        return copyAndFree(ptr, allocationSize<ExecSpace>(ptr));
+    }
+    void* newPtr = Kokkos::kokkos_realloc<ExecSpace>(ptr, newSize);
+    if (newPtr != nullptr && !isAligned(newPtr, policy.alignment))
+    {
+        return copyAndFree(newPtr, newSize);
+    }
+    return {newPtr, AllocationTraits {}};
+}
+
+}
+
+/**
+ * @brief Get the allocation policy shared by all executors of the same type.
+ * @param exec The executor to get the policy of.
+ */
+template<typename ExecutorType>
+const AllocationPolicy& allocationPolicy([[maybe_unused]] const ExecutorType& exec)
+{
+    return detail::allocationPolicy<ExecutorType>();
+}
+
+/**
+ * @brief Set the allocation policy shared by all executors of the same type.
+ *
+ * The policy applies to allocations made afterwards, it should be set before any fields are
+ * created and not concurrently to allocations.
+ * @param exec The executor to set the policy of.
+ * @param policy The new policy.
+ */
+template<typename ExecutorType>
+void setAllocationPolicy([[maybe_unused]] const ExecutorType& exec, const AllocationPolicy& policy)
+{
+    NF_ASSERT(
+        policy.alignment != 0 && (policy.alignment & (policy.alignment - 1)) == 0,
+        "alignment " << policy.alignment << " is not a power of two"
+    );
+    detail::allocationPolicy<ExecutorType>() = policy;
+}
+
+} // namespace NeoFOAM
@@ -8,12 +8,13 @@
 #include "NeoFOAM/core/executor/serialExecutor.hpp"
 #include "NeoFOAM/core/executor/GPUExecutor.hpp"
 #include "NeoFOAM/core/executor/CPUExecutor.hpp"
+#include "NeoFOAM/core/executor/poolExecutor.hpp"
 #include "NeoFOAM/core/error.hpp"
 
 namespace NeoFOAM
 {
 
-using Executor = std::variant<SerialExecutor, CPUExecutor, GPUExecutor>;
+using Executor = std::variant<SerialExecutor, CPUExecutor, GPUExecutor, PoolExecutor>;
 
 /**
  * @brief Checks if two executors are equal, i.e. they are of the same type.
@@ -53,4 +54,18 @@ using Executor = std::variant<SerialExecutor, CPUExecutor, GPUExecutor>;
     return !(lhs == rhs);
 };
 
+/** @copydoc allocationPolicy */
+inline const AllocationPolicy& allocationPolicy(const Executor& exec)
+{
+    return std::visit(
+        [](const auto& e) -> const AllocationPolicy& { return allocationPolicy(e); }, exec
+    );
+}
+
+/** @copydoc setAllocationPolicy */
+inline void setAllocationPolicy(const Executor& exec, const AllocationPolicy& policy)
+{
+    std::visit([&policy](const auto& e) { setAllocationPolicy(e, policy); }, exec);
+}
+
 } // namespace NeoFOAM
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief How the CPUExecutor places the pages of new allocations on the NUMA nodes.
+ *
+ * The operating system places a page on the node of the thread that first writes to it. Memory
+ * filled by a single thread, e.g. by copying a field from the SerialExecutor or from a
+ * std::vector, therefore ends up on a single node and the threads of the other sockets access it
+ * with a fraction of the bandwidth.
+ */
+enum class NumaPolicy
+{
+    none,       ///< Leave the placement to the first write to the memory.
+    firstTouch, ///< Touch the pages with the static partitioning of parallelFor.
+    interleave  ///< Distribute the pages round robin over all nodes available to the process.
+};
+
+/**
+ * @brief Get the process wide policy applied to allocations of the CPUExecutor.
+ */
+NumaPolicy numaPolicy();
+
+/**
+ * @brief Set the process wide policy applied to allocations of the CPUExecutor.
+ * @param policy The new policy, the default is NumaPolicy::firstTouch.
+ */
+void setNumaPolicy(NumaPolicy policy);
+
+/**
+ * @brief Get the size in bytes from which allocations of the CPUExecutor are placed.
+ */
+size_t numaThreshold();
+
+/**
+ * @brief Set the size in bytes from which allocations of the CPUExecutor are placed.
+ *
+ * Placing the pages costs a kernel launch and a fence, which outweighs the benefit for small
+ * temporaries that fit into the caches anyway.
+ * @param bytes The new threshold, the default is 1 MiB, zero places every allocation.
+ */
+void setNumaThreshold(size_t bytes);
+
+/**
+ * @brief Place the pages of newly allocated host memory according to the numa policy.
+ *
+ * With NumaPolicy::firstTouch one byte of each page is written by the thread which owns the
+ * corresponding part of the memory in a parallelFor over the default host execution space.
+ * With NumaPolicy::interleave the memory is bound round robin to all nodes before it is touched.
+ * Allocations smaller than the numaThreshold or than two pages are left untouched.
+ *
+ * @param ptr The newly allocated memory, its content is overwritten.
+ * @param bytes The size of the allocation in bytes.
+ */
+void placePages(void* ptr, size_t bytes);
+
+/**
+ * @brief The NUMA nodes the pages of a memory range reside on.
+ */
+struct PagePlacement
+{
+    size_t nPages {0};                 ///< The number of pages spanned by the memory.
+    size_t nUnplaced {0};              ///< The pages which are not mapped or could not be queried.
+    std::vector<size_t> pagesPerNode;  ///< The number of pages on each node.
+
+    /**
+     * @brief Get the fraction of the placed pages residing on the given node.
+     */
+    double fraction(size_t node) const;
+
+    /**
+     * @brief Print the number of pages on each node.
+     * @param out The stream to print to.
+     */
+    void print(std::ostream& out = std::cout) const;
+};
+
+/**
+ * @brief Query the NUMA nodes the pages of host memory reside on.
+ *
+ * The query does not touch the memory and hence does not change the placement. On systems
+ * without NUMA support all pages are reported as unplaced.
+ *
+ * @param ptr The start of the memory.
+ * @param bytes The size of the memory in bytes.
+ */
+PagePlacement pagePlacement(const void* ptr, size_t bytes);
+
+} // namespace NeoFOAM
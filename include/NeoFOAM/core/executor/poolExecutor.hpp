@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <Kokkos_Core.hpp> // IWYU pragma: keep
+
+#include "NeoFOAM/core/executor/allocationPolicy.hpp"
+#include "NeoFOAM/core/executor/numa.hpp"
+#include "NeoFOAM/core/executor/threadPool.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @class PoolExecutor
+ * @brief Executor for multicore CPUs balancing irregular kernels on a work stealing thread pool.
+ *
+ * The memory is allocated and placed like that of the CPUExecutor. parallelFor, parallelReduce and
+ * parallelScan distribute their range over the threads of detail::ThreadPool instead of a Kokkos
+ * execution space, which keeps all threads busy if the work per index varies, e.g. for chemistry
+ * of varying stiffness, adaptively refined cells or particles. Kernels launched through Kokkos
+ * directly, e.g. the team loops of parallelForSegments, run on the default host execution space.
+ *
+ * @ingroup Executor
+ */
+class PoolExecutor
+{
+public:
+
+    using exec = Kokkos::DefaultHostExecutionSpace;
+
+    PoolExecutor();
+    ~PoolExecutor();
+
+    template<typename T>
+    T* alloc(size_t size, const std::string& label = "Field") const
+    {
+        return static_cast<T*>(alloc(size * sizeof(T), label));
+    }
+
+    template<typename T>
+    T* realloc(void* ptr, size_t newSize) const
+    {
+        return static_cast<T*>(realloc(ptr, newSize * sizeof(T)));
+    }
+
+    /** @brief allocate memory on the memory space of the executor
+     *
+     * The pages are placed on the NUMA nodes and the alignment and huge pages follow the
+     * allocationPolicy of the executor like for the CPUExecutor.
+     * @param size The number of bytes to allocate
+     * @param label The label of the allocation shown by Kokkos tools and the AllocationCounter
+     * */
+    void* alloc(size_t size, const std::string& label = "Field") const
+    {
+        auto [ptr, traits] = detail::allocate<exec>(size, label, allocationPolicy(*this));
+        placePages(ptr, size);
+        return countAlloc(ptr, size, label, traits);
+    }
+
+    void* realloc(void* ptr, size_t newSize) const
+    {
+        auto [newPtr, traits] = detail::reallocate<exec>(ptr, newSize, allocationPolicy(*this));
+        return countRealloc(ptr, newPtr, newSize, traits);
+    }
+
+    /** @brief create a Kokkos view for a given ptr
+     *
+     * Based on the executor this function creates a Kokkos view into the data managed by ptr
+     * @param ptr Pointer to data for which a view should be created
+     * @param size Number of elements this view contains
+     * @tparam ValueType The value type the underlying memory holds
+     * */
+    template<typename ValueType>
+    decltype(auto) createKokkosView(ValueType* ptr, size_t size) const
+    {
+        return Kokkos::View<ValueType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(ptr, size);
+    }
+
+    void free(void* ptr) const noexcept
+    {
+        countFree(ptr);
+        detail::deallocate<exec>(ptr);
+    };
+
+    std::string name() const { return "PoolExecutor"; };
+};
+
+/**
+ * @brief Get the number of threads of the pool shared by all PoolExecutors.
+ */
+inline size_t poolThreads() { return detail::ThreadPool::instance().size(); }
+
+/**
+ * @brief Set the number of threads of the pool shared by all PoolExecutors.
+ *
+ * By default the pool has as many threads as the default host execution space.
+ * @warning This must not be called while a kernel of a PoolExecutor runs.
+ * @param nThreads The number of threads including the thread launching the kernels.
+ */
+inline void setPoolThreads(size_t nThreads) { detail::ThreadPool::instance().resize(nThreads); }
+
+} // namespace NeoFOAM
@@ -4,6 +4,8 @@
 
 #include <Kokkos_Core.hpp>
 
+#include "NeoFOAM/core/executor/allocationPolicy.hpp"
+
 namespace NeoFOAM
 {
 
@@ -23,15 +25,15 @@ public:
     ~SerialExecutor();
 
     template<typename T>
-    T* alloc(size_t size) const
+    T* alloc(size_t size, const std::string& label = "Field") const
     {
-        return static_cast<T*>(Kokkos::kokkos_malloc<exec>("Field", size * sizeof(T)));
+        return static_cast<T*>(alloc(size * sizeof(T), label));
     }
 
     template<typename T>
     T* realloc(void* ptr, size_t newSize) const
     {
-        return static_cast<T*>(Kokkos::kokkos_realloc<exec>(ptr, newSize * sizeof(T)));
+        return static_cast<T*>(realloc(ptr, newSize * sizeof(T)));
     }
 
     /** @brief create a Kokkos view for a given ptr
@@ -47,14 +49,28 @@ public:
         return Kokkos::View<ValueType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(ptr, size);
     }
 
-    void* alloc(size_t size) const { return Kokkos::kokkos_malloc<exec>("Field", size); }
+    /** @brief allocate memory on the memory space of the executor
+     * The alignment and the huge pages follow the allocationPolicy of the executor.
+     * @param size The number of bytes to allocate
+     * @param label The label of the allocation shown by Kokkos tools and the AllocationCounter
+     * */
+    void* alloc(size_t size, const std::string& label = "Field") const
+    {
+        auto [ptr, traits] = detail::allocate<exec>(size, label, allocationPolicy(*this));
+        return countAlloc(ptr, size, label, traits);
+    }
 
     void* realloc(void* ptr, size_t newSize) const
     {
-        return Kokkos::kokkos_realloc<exec>(ptr, newSize);
+        auto [newPtr, traits] = detail::reallocate<exec>(ptr, newSize, allocationPolicy(*this));
+        return countRealloc(ptr, newPtr, newSize, traits);
     }
 
-    void free(void* ptr) const noexcept { Kokkos::kokkos_free<exec>(ptr); };
+    void free(void* ptr) const noexcept
+    {
+        countFree(ptr);
+        detail::deallocate<exec>(ptr);
+    };
 
     std::string name() const { return "SerialExecutor"; };
 };
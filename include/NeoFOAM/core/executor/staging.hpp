@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+
+#include <Kokkos_Core.hpp>
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief The memory space of the staging buffers, page locked host memory if the backend
+ * provides it.
+ */
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+using PinnedSpace = Kokkos::SharedHostPinnedSpace;
+#else
+using PinnedSpace = Kokkos::HostSpace;
+#endif
+
+class StagingPool;
+
+/**
+ * @class StagingBuffer
+ * @brief A page locked host buffer borrowed from the StagingPool, returned to it on destruction.
+ */
+class StagingBuffer
+{
+public:
+
+    StagingBuffer(const StagingBuffer&) = delete;
+    StagingBuffer& operator=(const StagingBuffer&) = delete;
+
+    StagingBuffer(StagingBuffer&& other) noexcept;
+    StagingBuffer& operator=(StagingBuffer&& other) noexcept;
+
+    ~StagingBuffer();
+
+    void* data() const { return data_; }
+
+    /**
+     * @brief Get the capacity of the buffer, at least the requested size.
+     */
+    size_t bytes() const { return bytes_; }
+
+private:
+
+    friend class StagingPool;
+
+    StagingBuffer(void* data, size_t bytes) : data_(data), bytes_(bytes) {}
+
+    void* data_;
+    size_t bytes_;
+};
+
+/**
+ * @class StagingPool
+ * @brief A process wide pool of page locked host buffers for transfers between host and device.
+ *
+ * Copies from and to page locked memory run asynchronously to the host and at the full bandwidth
+ * of the interconnect, but allocating page locked memory is expensive. The pool therefore keeps
+ * released buffers and hands them out again, the capacities are rounded up to powers of two so
+ * that transfers of similar size share buffers. The buffers are freed by release and when Kokkos
+ * is finalized.
+ */
+class StagingPool
+{
+public:
+
+    /**
+     * @brief The number of buffers allocated and reused since the last reset.
+     */
+    struct Stats
+    {
+        size_t nAllocations {0}; ///< The buffers allocated from PinnedSpace.
+        size_t nReuses {0};      ///< The requests served by a cached buffer.
+        size_t bytesCached {0};  ///< The capacity of the buffers currently held by the pool.
+    };
+
+    static StagingPool& instance();
+
+    /**
+     * @brief Borrow a buffer of at least the given size.
+     * @param bytes The requested size in bytes.
+     */
+    StagingBuffer acquire(size_t bytes);
+
+    /**
+     * @brief Free the buffers held by the pool, borrowed buffers are cached again when returned.
+     */
+    void release();
+
+    Stats stats() const;
+
+    void resetStats();
+
+private:
+
+    friend class StagingBuffer;
+
+    StagingPool() = default;
+
+    void giveBack(void* data, size_t bytes);
+
+    void finalize();
+
+    mutable std::mutex mutex_;
+    std::multimap<size_t, void*> cached_;
+    Stats stats_;
+    bool finalizeHook_ {false};
+};
+
+/**
+ * @class TransferEvent
+ * @brief Completion event of an asynchronous transfer.
+ *
+ * The source and destination of the transfer have to stay alive until the event completed. The
+ * destructor waits for the completion, so discarding the event makes a transfer synchronous.
+ */
+class TransferEvent
+{
+public:
+
+    /**
+     * @brief Create a completed event.
+     */
+    TransferEvent() = default;
+
+    /**
+     * @brief Create a pending event.
+     * @param complete Waits for the transfer and finishes it, e.g. by copying out of a staging
+     * buffer.
+     */
+    explicit TransferEvent(std::function<void()> complete) : complete_(std::move(complete)) {}
+
+    TransferEvent(const TransferEvent&) = delete;
+    TransferEvent& operator=(const TransferEvent&) = delete;
+
+    TransferEvent(TransferEvent&& other) noexcept : complete_(std::move(other.complete_))
+    {
+        other.complete_ = nullptr;
+    }
+
+    TransferEvent& operator=(TransferEvent&& other) noexcept
+    {
+        wait();
+        complete_ = std::move(other.complete_);
+        other.complete_ = nullptr;
+        return *this;
+    }
+
+    ~TransferEvent() { wait(); }
+
+    /**
+     * @brief Check whether wait has still to be called to complete the transfer.
+     */
+    bool pending() const { return static_cast<bool>(complete_); }
+
+    /**
+     * @brief Block until the transfer is complete.
+     */
+    void wait()
+    {
+        if (complete_)
+        {
+            auto complete = std::move(complete_);
+            complete_ = nullptr;
+            complete();
+        }
+    }
+
+private:
+
+    std::function<void()> complete_;
+};
+
+/**
+ * @brief Get the execution space instance asynchronous transfers are enqueued on.
+ *
+ * The instance is separate from the default instance where the backend supports it, so
+ * transfers overlap with kernels launched by the executors afterwards. It is not ordered after
+ * kernels already launched, the default instance has to be fenced before enqueuing a transfer
+ * of memory they access.
+ */
+Kokkos::DefaultExecutionSpace transferSpace();
+
+} // namespace NeoFOAM
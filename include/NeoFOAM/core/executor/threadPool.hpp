@@ -0,0 +1,198 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace NeoFOAM::detail
+{
+
+/**
+ * @brief The chunks [begin, end) of a loop on the ThreadPool.
+ */
+struct ChunkRange
+{
+    uint32_t begin;
+    uint32_t end;
+};
+
+/**
+ * @class WorkStealingDeque
+ * @brief A Chase-Lev deque, the owning thread pushes and pops at the bottom while other threads
+ * steal from the top.
+ *
+ * The owner works on the ranges it split off last, which are the smallest, while thieves take the
+ * oldest and largest ones, so every steal moves as much work as possible. The memory orders follow
+ * Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013. A full
+ * buffer is replaced by one of twice the size, the replaced buffers are kept until the deque is
+ * destroyed, since thieves may still read from them.
+ */
+class WorkStealingDeque
+{
+public:
+
+    /**
+     * @param capacity The initial number of ranges, a power of two.
+     */
+    explicit WorkStealingDeque(size_t capacity = 64);
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Add a range at the bottom, only called by the owner or while no other thread
+     * accesses the deque.
+     */
+    void push(ChunkRange range);
+
+    /**
+     * @brief Take the range at the bottom, only called by the owner.
+     */
+    std::optional<ChunkRange> pop();
+
+    /**
+     * @brief Take the range at the top, called by any thread.
+     *
+     * Returns nothing if the deque is empty or another thread took the range first.
+     */
+    std::optional<ChunkRange> steal();
+
+    /**
+     * @brief Check whether the deque is empty, exact only when called by the owner.
+     */
+    bool empty() const;
+
+private:
+
+    struct Buffer
+    {
+        explicit Buffer(size_t capacity);
+
+        size_t capacity() const { return mask + 1; }
+
+        ChunkRange load(int64_t i) const;
+
+        void store(int64_t i, ChunkRange range);
+
+        size_t mask;
+        std::unique_ptr<std::atomic<ChunkRange>[]> ranges;
+    };
+
+    alignas(64) std::atomic<int64_t> top_ {0};
+    alignas(64) std::atomic<int64_t> bottom_ {0};
+    alignas(64) std::atomic<Buffer*> buffer_;
+    std::vector<std::unique_ptr<Buffer>> buffers_;
+};
+
+/**
+ * @class ThreadPool
+ * @brief The threads of the PoolExecutor, which balance loops by work stealing.
+ *
+ * A loop is split into chunks of consecutive indices. Every thread starts on an equal share of the
+ * chunks in its deque, so balanced loops access memory like a static schedule, and processes it
+ * chunk by chunk. Whenever its deque is empty, i.e. the last range it offered was stolen, the
+ * thread pushes the upper half of its remaining chunks. Thus ranges are only split as far as the
+ * load imbalance requires (lazy binary splitting), and threads which run out of work steal from
+ * the deques of randomly chosen threads until all chunks are processed.
+ *
+ * The calling thread takes part in the loop as worker 0. Loops launched from within a chunk run on
+ * the calling worker only, loops launched by different threads run one after the other. Between
+ * loops the threads spin briefly before they sleep, which keeps the latency of consecutive loops
+ * low.
+ */
+class ThreadPool
+{
+public:
+
+    /**
+     * @brief Process the chunks [first, last) of a loop on a worker.
+     */
+    using ChunkFunction = void (*)(const void* body, size_t first, size_t last, size_t worker);
+
+    /**
+     * @brief Get the pool of the PoolExecutor, by default with one thread per core of the default
+     * host execution space.
+     */
+    static ThreadPool& instance();
+
+    /**
+     * @param nThreads The number of threads including the calling thread.
+     */
+    explicit ThreadPool(size_t nThreads);
+
+    ThreadPool(const ThreadPool&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool();
+
+    /**
+     * @brief Get the number of threads including the calling thread.
+     */
+    size_t size() const { return deques_.size(); }
+
+    /**
+     * @brief Restart the pool with a different number of threads.
+     *
+     * @warning This must not be called while a loop runs.
+     * @param nThreads The number of threads including the calling thread.
+     */
+    void resize(size_t nThreads);
+
+    /**
+     * @brief Process the chunks of a loop on all threads and return once all are done.
+     * @param nChunks The number of chunks, at most 2^32 - 1.
+     * @param body The work on the chunks, void(size_t first, size_t last, size_t worker), where
+     * worker is the index of the thread in [0, size()).
+     */
+    template<typename Body>
+    void run(size_t nChunks, const Body& body)
+    {
+        run(
+            nChunks,
+            [](const void* b, size_t first, size_t last, size_t worker)
+            { (*static_cast<const Body*>(b))(first, last, worker); },
+            &body
+        );
+    }
+
+    /** @copydoc run */
+    void run(size_t nChunks, ChunkFunction function, const void* body);
+
+private:
+
+    void start(size_t nThreads);
+
+    void stop();
+
+    void work(size_t worker, uint64_t generation);
+
+    void execute(size_t worker);
+
+    void process(size_t worker);
+
+    std::vector<std::unique_ptr<WorkStealingDeque>> deques_;
+    std::vector<std::thread> threads_;
+
+    std::mutex launchMutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::atomic<uint64_t> generation_ {0};
+    size_t nBusy_ {0};
+    bool stopping_ {false};
+
+    ChunkFunction function_ {nullptr};
+    const void* body_ {nullptr};
+    std::atomic<size_t> remaining_ {0};
+};
+
+} // namespace NeoFOAM::detail
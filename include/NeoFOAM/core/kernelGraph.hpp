@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/executor/allocationPolicy.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/fields/field.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @class KernelGraph
+ * @brief A recorded sequence of kernel launches which can be replayed without the host code that
+ * launched them.
+ *
+ * While a graph is captured, every parallelFor, parallelScan without result, parallelForSegments
+ * and parallelReduceSegments of the calling thread is executed and recorded together with its
+ * executor type, range and kernel. Replaying calls the recorded launches in order, which skips
+ * the dispatch on the executor, the host logic of operators and time integrators, the creation
+ * of temporaries and the setup of boundary conditions. The kernels keep the spans and values they
+ * captured, hence:
+ *
+ * - memory freed during the capture, e.g. of temporary fields or by resizing a field, is kept
+ *   alive by the graph until it is cleared or destroyed,
+ * - fields the kernels read or write must not be resized or destroyed, which can be checked on
+ *   replay by tracking them,
+ * - values computed on the host, e.g. the time step size, are those of the captured step,
+ * - copies with Kokkos::deep_copy, e.g. from host data, are only done during the capture.
+ *
+ * Reductions and scans returning a value to the host and sorts can not be replayed; if they are
+ * launched during the capture, the graph is not replayable.
+ *
+ * @code
+ * KernelGraph step;
+ * step.capture([&]() { timeIntegrator.solve(eqn, phi, t, dt); });
+ * step.track(phi.internalField());
+ * for (size_t i = 1; i < nSteps; i++)
+ * {
+ *     step.replay();
+ * }
+ * @endcode
+ */
+class KernelGraph
+{
+public:
+
+    KernelGraph() = default;
+
+    KernelGraph(const KernelGraph&) = delete;
+
+    KernelGraph& operator=(const KernelGraph&) = delete;
+
+    KernelGraph(KernelGraph&& rhs) noexcept { swap(rhs); }
+
+    KernelGraph& operator=(KernelGraph&& rhs) noexcept
+    {
+        clear();
+        swap(rhs);
+        return *this;
+    }
+
+    ~KernelGraph() { clear(); }
+
+    /**
+     * @brief Run a function and record the kernels it launches, replacing the previous capture.
+     * @param body The function, e.g. performing a time step.
+     */
+    template<typename Body>
+    void capture(Body body)
+    {
+        NF_ASSERT_THROW(
+            detail::kernelRecording() == nullptr, "KernelGraph captures can not be nested"
+        );
+        clear();
+        detail::KernelRecording recording;
+        {
+            CaptureScope scope(recording, deferredFrees_);
+            body();
+        }
+        launches_ = std::move(recording.launches);
+        unsupported_ = std::move(recording.unsupported);
+    }
+
+    /**
+     * @brief Check on every replay that a field still has the data and size it had.
+     * @param field The field, it must outlive the graph.
+     */
+    template<typename ValueType>
+    void track(const Field<ValueType>& field)
+    {
+        tracked_.push_back({field.data(), field.size(), [&field]() {
+                                return std::pair<const void*, size_t>(field.data(), field.size());
+                            }});
+    }
+
+    /**
+     * @brief Launch the recorded kernels in order.
+     *
+     * Throws if the capture contained launches which can not be replayed or a tracked field was
+     * reallocated or resized.
+     */
+    void replay() const
+    {
+        NF_ASSERT_THROW(
+            replayable(),
+            "The captured kernels contain launches which can not be replayed, e.g. "
+                << unsupported_.front()
+        );
+        for (const auto& field : tracked_)
+        {
+            auto [data, size] = field.current();
+            NF_ASSERT_THROW(
+                data == field.data && size == field.size,
+                "A field tracked by the KernelGraph was reallocated or resized since the capture"
+            );
+        }
+        for (const auto& launch : launches_)
+        {
+            launch();
+        }
+    }
+
+    /**
+     * @brief Check whether all launches of the capture can be replayed.
+     */
+    bool replayable() const { return unsupported_.empty(); }
+
+    /**
+     * @brief Get the names of the launches which can not be replayed.
+     */
+    const std::vector<std::string>& unsupported() const { return unsupported_; }
+
+    /**
+     * @brief Get the number of recorded launches.
+     */
+    size_t size() const { return launches_.size(); }
+
+    /**
+     * @brief Remove the recorded launches and tracked fields and free the memory kept alive.
+     */
+    void clear()
+    {
+        launches_.clear();
+        unsupported_.clear();
+        tracked_.clear();
+        for (const auto& deferred : deferredFrees_)
+        {
+            deferred.deallocate(deferred.ptr);
+        }
+        deferredFrees_.clear();
+    }
+
+private:
+
+    /**
+     * @brief Installs the recording and the deferred deallocations of the calling thread.
+     */
+    class CaptureScope
+    {
+    public:
+
+        CaptureScope(detail::KernelRecording& recording, std::vector<detail::DeferredFree>& frees)
+        {
+            detail::kernelRecording() = &recording;
+            detail::deferredFrees() = &frees;
+        }
+
+        CaptureScope(const CaptureScope&) = delete;
+
+        CaptureScope& operator=(const CaptureScope&) = delete;
+
+        ~CaptureScope()
+        {
+            detail::kernelRecording() = nullptr;
+            detail::deferredFrees() = nullptr;
+        }
+    };
+
+    struct TrackedField
+    {
+        const void* data;
+        size_t size;
+        std::function<std::pair<const void*, size_t>()> current;
+    };
+
+    void swap(KernelGraph& rhs) noexcept
+    {
+        std::swap(launches_, rhs.launches_);
+        std::swap(unsupported_, rhs.unsupported_);
+        std::swap(tracked_, rhs.tracked_);
+        std::swap(deferredFrees_, rhs.deferredFrees_);
+    }
+
+    std::vector<std::function<void()>> launches_;
+    std::vector<std::string> unsupported_;
+    std::vector<TrackedField> tracked_;
+    std::vector<detail::DeferredFree> deferredFrees_; ///< The memory freed during the capture.
+};
+
+} // namespace NeoFOAM
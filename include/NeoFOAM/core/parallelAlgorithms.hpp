@@ -3,7 +3,13 @@
 #pragma once
 
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include "NeoFOAM/core/executor/executor.hpp"
 
@@ -23,11 +29,658 @@ concept parallelForKernel = requires(Kernel t, size_t i) {
     } -> std::same_as<void>;
 };
 
+/**
+ * @brief Executors other than the SerialExecutor whose kernels run on the host.
+ *
+ * Kernels of these executors can also be executed inline on the calling thread, which avoids the
+ * cost of waking up the threads for small ranges.
+ */
+template<typename ExecutorType>
+concept hostParallelExecutor =
+    !std::is_same_v<ExecutorType, SerialExecutor>
+    && Kokkos::SpaceAccessibility<typename ExecutorType::exec, Kokkos::HostSpace>::accessible;
+
+/**
+ * @brief How parallelReduce combines the contributions of the indices.
+ */
+enum class ReduceMode
+{
+    fast,        ///< Let Kokkos combine the results of the threads, the order depends on their count.
+    reproducible ///< Reduce fixed blocks and combine them in a fixed order, see parallelReduce.
+};
+
+namespace detail
+{
+
+template<typename ExecutorType>
+size_t& serialThreshold()
+{
+    static size_t threshold = 256;
+    return threshold;
+}
+
+/**
+ * @brief Check if a range of the given size is run inline on the calling thread.
+ */
+template<typename ExecutorType>
+bool runInline(size_t size)
+{
+    if constexpr (hostParallelExecutor<ExecutorType>)
+    {
+        return size < serialThreshold<ExecutorType>();
+    }
+    else
+    {
+        return false;
+    }
+}
+
+/**
+ * @brief The launches recorded while a KernelGraph is captured on the calling thread.
+ */
+struct KernelRecording
+{
+    std::vector<std::function<void()>> launches;
+    std::vector<std::string> unsupported; ///< The names of the launches which can not be replayed.
+};
+
+inline KernelRecording*& kernelRecording()
+{
+    static thread_local KernelRecording* recording = nullptr;
+    return recording;
+}
+
+/**
+ * @brief Note a launch which can not be replayed, e.g. a reduction returning its result to the
+ * host, if a KernelGraph is captured.
+ */
+inline void recordUnsupported(const std::string& name)
+{
+    if (auto* recording = kernelRecording())
+    {
+        recording->unsupported.push_back(name);
+    }
+}
+
+/**
+ * @brief Run a reduction on the calling thread, the result is initialised like Kokkos does.
+ */
+template<typename Kernel, typename T>
+void inlineReduce(size_t start, size_t end, Kernel kernel, T& value)
+{
+    if constexpr (Kokkos::is_reducer<T>::value)
+    {
+        typename T::value_type result;
+        value.init(result);
+        for (size_t i = start; i < end; i++)
+        {
+            kernel(i, result);
+        }
+        value.reference() = result;
+    }
+    else
+    {
+        T result {};
+        for (size_t i = start; i < end; i++)
+        {
+            kernel(i, result);
+        }
+        value = result;
+    }
+}
+
+inline ReduceMode& reduceMode()
+{
+    static ReduceMode mode = ReduceMode::fast;
+    return mode;
+}
+
+/**
+ * @brief The number of consecutive indices reduced by one thread in reproducible mode.
+ */
+constexpr size_t reproducibleBlockSize = 256;
+
+template<typename T>
+struct ReduceValue
+{
+    using type = T;
+};
+
+template<typename T>
+    requires Kokkos::is_reducer<T>::value
+struct ReduceValue<T>
+{
+    using type = typename T::value_type;
+};
+
+/**
+ * @brief The type of the running value of a scan kernel, void(const size_t i, T& update, bool).
+ */
+template<typename Operator>
+struct ScanValue
+{};
+
+template<typename Class, typename Index, typename T>
+struct ScanValue<void (Class::*)(Index, T&, bool) const>
+{
+    using type = T;
+};
+
+template<typename Kernel>
+concept serialScanKernel = requires { typename ScanValue<decltype(&Kernel::operator())>::type; };
+
+/**
+ * @brief The number of chunks per thread a range is split into on the PoolExecutor.
+ *
+ * This leaves idle threads enough chunks to steal while the call per chunk stays negligible.
+ */
+constexpr size_t poolChunksPerThread = 64;
+
+/**
+ * @brief The chunks of a range processed by the ThreadPool.
+ */
+struct PoolChunks
+{
+    size_t start;
+    size_t size;
+    size_t nChunks;
+
+    PoolChunks(size_t first, size_t last, size_t nThreads)
+        : start(first), size(last - first), nChunks(std::min(size, poolChunksPerThread * nThreads))
+    {}
+
+    /**
+     * @brief Get the first index of a chunk, or the end of the range for nChunks.
+     */
+    size_t begin(size_t chunk) const { return start + chunk * size / nChunks; }
+};
+
+/**
+ * @brief Run a kernel for every index of a range on the ThreadPool.
+ */
+template<typename Kernel>
+void poolFor(const std::string& name, size_t start, size_t end, const Kernel& kernel)
+{
+    Kokkos::Profiling::ScopedRegion region(name);
+    auto& pool = ThreadPool::instance();
+    const PoolChunks chunks(start, end, pool.size());
+    pool.run(
+        chunks.nChunks,
+        [&](size_t first, size_t last, size_t)
+        {
+            for (size_t i = chunks.begin(first); i < chunks.begin(last); i++)
+            {
+                kernel(i);
+            }
+        }
+    );
+}
+
+/**
+ * @brief Reduce a range on the ThreadPool, every thread accumulates the chunks it processes and
+ * the results of the threads are combined in order.
+ */
+template<typename Kernel, typename T>
+void poolReduce(const std::string& name, size_t start, size_t end, const Kernel& kernel, T& value)
+{
+    using ValueType = typename ReduceValue<T>::type;
+    // the accumulators of the threads are kept on separate cache lines
+    struct alignas(64) Partial
+    {
+        ValueType value;
+    };
+
+    Kokkos::Profiling::ScopedRegion region(name);
+    auto& pool = ThreadPool::instance();
+    const PoolChunks chunks(start, end, pool.size());
+    std::vector<Partial> partials(pool.size());
+    for (auto& partial : partials)
+    {
+        if constexpr (Kokkos::is_reducer<T>::value)
+        {
+            value.init(partial.value);
+        }
+        else
+        {
+            partial.value = ValueType {};
+        }
+    }
+    pool.run(
+        chunks.nChunks,
+        [&](size_t first, size_t last, size_t worker)
+        {
+            for (size_t i = chunks.begin(first); i < chunks.begin(last); i++)
+            {
+                kernel(i, partials[worker].value);
+            }
+        }
+    );
+
+    ValueType result = partials[0].value;
+    for (size_t worker = 1; worker < partials.size(); worker++)
+    {
+        if constexpr (Kokkos::is_reducer<T>::value)
+        {
+            value.join(result, partials[worker].value);
+        }
+        else
+        {
+            result += partials[worker].value;
+        }
+    }
+    if constexpr (Kokkos::is_reducer<T>::value)
+    {
+        value.reference() = result;
+    }
+    else
+    {
+        value = result;
+    }
+}
+
+/**
+ * @brief Scan a range on the ThreadPool and return the total.
+ *
+ * The chunks are scanned twice, first to compute their sums, whose exclusive prefix sum gives the
+ * running value each chunk starts from in the final pass.
+ */
+template<typename ValueType, typename Kernel>
+ValueType poolScan(const std::string& name, size_t start, size_t end, const Kernel& kernel)
+{
+    Kokkos::Profiling::ScopedRegion region(name);
+    auto& pool = ThreadPool::instance();
+    const PoolChunks chunks(start, end, pool.size());
+    std::vector<ValueType> offsets(chunks.nChunks);
+    auto scanChunks = [&](bool final)
+    {
+        pool.run(
+            chunks.nChunks,
+            [&](size_t first, size_t last, size_t)
+            {
+                for (size_t chunk = first; chunk < last; chunk++)
+                {
+                    ValueType update = final ? offsets[chunk] : ValueType {};
+                    for (size_t i = chunks.begin(chunk); i < chunks.begin(chunk + 1); i++)
+                    {
+                        kernel(i, update, final);
+                    }
+                    if (!final)
+                    {
+                        offsets[chunk] = update;
+                    }
+                }
+            }
+        );
+    };
+
+    scanChunks(false);
+    ValueType total {};
+    for (auto& offset : offsets)
+    {
+        ValueType sum = offset;
+        offset = total;
+        total += sum;
+    }
+    scanChunks(true);
+    return total;
+}
+
+/**
+ * @brief Launch a parallel_for over a range on the executor type.
+ */
+template<typename ExecutorType, typename Functor>
+void launchFor(const std::string& name, size_t start, size_t end, const Functor& functor)
+{
+    if constexpr (std::is_same_v<ExecutorType, PoolExecutor>)
+    {
+        poolFor(name, start, end, functor);
+    }
+    else
+    {
+        using runOn = typename ExecutorType::exec;
+        Kokkos::parallel_for(name, Kokkos::RangePolicy<runOn>(start, end), functor);
+    }
+}
+
+/**
+ * @brief Launch a parallel_reduce over a range on the executor type.
+ */
+template<typename ExecutorType, typename Kernel, typename T>
+void launchReduce(const std::string& name, size_t start, size_t end, const Kernel& kernel, T& value)
+{
+    if constexpr (std::is_same_v<ExecutorType, PoolExecutor>)
+    {
+        poolReduce(name, start, end, kernel, value);
+    }
+    else
+    {
+        using runOn = typename ExecutorType::exec;
+        Kokkos::parallel_reduce(name, Kokkos::RangePolicy<runOn>(start, end), kernel, value);
+    }
+}
+
+/**
+ * @brief Launch a parallel_scan over a range on the executor type.
+ */
+template<typename ExecutorType, typename Kernel, typename... ReturnType>
+void launchScan(
+    const std::string& name, size_t start, size_t end, const Kernel& kernel, ReturnType&... value
+)
+{
+    if constexpr (std::is_same_v<ExecutorType, PoolExecutor> && sizeof...(ReturnType) == 1)
+    {
+        ((value = poolScan<ReturnType>(name, start, end, kernel)), ...);
+    }
+    else if constexpr (std::is_same_v<ExecutorType, PoolExecutor> && serialScanKernel<Kernel>)
+    {
+        poolScan<typename ScanValue<decltype(&Kernel::operator())>::type>(name, start, end, kernel);
+    }
+    else
+    {
+        // including scans on the PoolExecutor whose running value type can not be deduced
+        using runOn = typename ExecutorType::exec;
+        Kokkos::parallel_scan(name, Kokkos::RangePolicy<runOn>(start, end), kernel, value...);
+    }
+}
+
+/**
+ * @brief Reduce one block of indices in order, sums of floating point values are compensated.
+ */
+template<typename Kernel, typename T>
+struct ReproducibleBlock
+{
+    using ValueType = typename ReduceValue<T>::type;
+
+    Kernel kernel;
+    T reducer;
+    size_t start;
+    size_t end;
+
+    KOKKOS_INLINE_FUNCTION
+    ValueType operator()(const size_t block) const
+    {
+        const size_t first = start + block * reproducibleBlockSize;
+        const size_t last = first + reproducibleBlockSize < end ? first + reproducibleBlockSize : end;
+        if constexpr (Kokkos::is_reducer<T>::value)
+        {
+            ValueType acc;
+            reducer.init(acc);
+            for (size_t i = first; i < last; i++)
+            {
+                kernel(i, acc);
+            }
+            return acc;
+        }
+        else if constexpr (std::is_floating_point_v<ValueType>)
+        {
+            // Neumaier summation of the contribution of each index
+            ValueType sum {};
+            ValueType compensation {};
+            for (size_t i = first; i < last; i++)
+            {
+                ValueType term {};
+                kernel(i, term);
+                ValueType t = sum + term;
+                compensation += (sum < 0 ? -sum : sum) >= (term < 0 ? -term : term)
+                                  ? (sum - t) + term
+                                  : (term - t) + sum;
+                sum = t;
+            }
+            return sum + compensation;
+        }
+        else
+        {
+            ValueType acc {};
+            for (size_t i = first; i < last; i++)
+            {
+                kernel(i, acc);
+            }
+            return acc;
+        }
+    }
+};
+
+/**
+ * @brief Reduce a range independent of the executor and its thread count.
+ *
+ * The range is split into blocks of reproducibleBlockSize indices, which are reduced in order by
+ * a single thread each. The results of the blocks are combined pairwise on the host in a tree
+ * which only depends on the number of blocks.
+ */
+template<typename Executor, typename Kernel, typename T>
+void reproducibleReduce(
+    size_t start, size_t end, Kernel kernel, T& value, const std::string& name
+)
+{
+    using ValueType = typename ReduceValue<T>::type;
+    const size_t nBlocks = (end - start + reproducibleBlockSize - 1) / reproducibleBlockSize;
+    ReproducibleBlock<Kernel, T> block {kernel, value, start, end};
+    auto partials = std::make_unique<ValueType[]>(nBlocks);
+
+    if (std::is_same_v<Executor, SerialExecutor> || runInline<Executor>(end - start))
+    {
+        for (size_t b = 0; b < nBlocks; b++)
+        {
+            partials[b] = block(b);
+        }
+    }
+    else
+    {
+        using runOn = typename Executor::exec;
+        Kokkos::View<ValueType*, typename runOn::memory_space> blockValues(
+            name + "::blocks", nBlocks
+        );
+        launchFor<Executor>(
+            name, 0, nBlocks, KOKKOS_LAMBDA(const size_t b) { blockValues(b) = block(b); }
+        );
+        Kokkos::deep_copy(
+            Kokkos::View<ValueType*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
+                partials.get(), nBlocks
+            ),
+            blockValues
+        );
+    }
+
+    for (size_t width = 1; width < nBlocks; width *= 2)
+    {
+        for (size_t b = 0; b + width < nBlocks; b += 2 * width)
+        {
+            if constexpr (Kokkos::is_reducer<T>::value)
+            {
+                value.join(partials[b], partials[b + width]);
+            }
+            else
+            {
+                partials[b] += partials[b + width];
+            }
+        }
+    }
+
+    if constexpr (Kokkos::is_reducer<T>::value)
+    {
+        if (nBlocks == 0)
+        {
+            value.init(value.reference());
+            return;
+        }
+        value.reference() = partials[0];
+    }
+    else
+    {
+        value = nBlocks == 0 ? ValueType {} : partials[0];
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Get the size below which ranges of a host executor are run inline on the calling thread.
+ *
+ * The threshold applies to parallelFor and parallelReduce and is ignored by executors which do not
+ * run on the host.
+ * @param exec The executor to get the threshold of.
+ */
+template<typename ExecutorType>
+size_t serialThreshold([[maybe_unused]] const ExecutorType& exec)
+{
+    return detail::serialThreshold<ExecutorType>();
+}
+
+/** @copydoc serialThreshold */
+inline size_t serialThreshold(const Executor& exec)
+{
+    return std::visit([](const auto& e) { return serialThreshold(e); }, exec);
+}
+
+/**
+ * @brief Set the size below which ranges of a host executor are run inline on the calling thread.
+ *
+ * The threshold is shared by all executors of the same type, zero disables the fallback.
+ * @param exec The executor to set the threshold of.
+ * @param threshold The new threshold.
+ */
+template<typename ExecutorType>
+void setSerialThreshold([[maybe_unused]] const ExecutorType& exec, size_t threshold)
+{
+    detail::serialThreshold<ExecutorType>() = threshold;
+}
+
+/** @copydoc setSerialThreshold */
+inline void setSerialThreshold(const Executor& exec, size_t threshold)
+{
+    std::visit([threshold](const auto& e) { setSerialThreshold(e, threshold); }, exec);
+}
+
+/**
+ * @brief Get the process wide mode of parallelReduce calls without an explicit mode.
+ */
+inline ReduceMode reduceMode() { return detail::reduceMode(); }
+
+/**
+ * @brief Set the process wide mode of parallelReduce calls without an explicit mode.
+ *
+ * The mode should be set at startup, e.g. by regression tests comparing against baselines.
+ * @param mode The new mode, the default is ReduceMode::fast.
+ */
+inline void setReduceMode(ReduceMode mode) { detail::reduceMode() = mode; }
+
+/**
+ * @brief Measure the size below which inline execution beats a Kokkos launch and use it as
+ * threshold.
+ *
+ * A streaming kernel of increasing size is run both ways and the threshold is set to the first
+ * size for which the Kokkos launch is faster. Executors which do not run on the host are left
+ * unchanged.
+ * @param exec The executor to tune.
+ * @param maxSize The largest size to test, which is used as threshold if Kokkos never wins.
+ * @return The new threshold.
+ */
+template<typename ExecutorType>
+size_t tuneSerialThreshold(const ExecutorType& exec, size_t maxSize = 1 << 14)
+{
+    if constexpr (hostParallelExecutor<ExecutorType>)
+    {
+        std::vector<double> buffer(maxSize, 1.0);
+        double* data = buffer.data();
+        auto kernel = [data](const size_t i) { data[i] = 0.5 * data[i] + 1.0; };
+        auto best = [](auto run)
+        {
+            double result = std::numeric_limits<double>::max();
+            for (int rep = 0; rep < 20; rep++)
+            {
+                Kokkos::Timer timer;
+                run();
+                result = std::min(result, timer.seconds());
+            }
+            return result;
+        };
+
+        size_t threshold = maxSize;
+        for (size_t size = 1; size <= maxSize; size *= 2)
+        {
+            double inlineTime = best(
+                [&]()
+                {
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        kernel(i);
+                    }
+                }
+            );
+            double launchTime = best(
+                [&]()
+                {
+                    detail::launchFor<ExecutorType>("NeoFOAM::tuneSerialThreshold", 0, size, kernel);
+                    Kokkos::fence();
+                }
+            );
+            if (launchTime < inlineTime)
+            {
+                threshold = size;
+                break;
+            }
+        }
+        setSerialThreshold(exec, threshold);
+    }
+    return serialThreshold(exec);
+}
+
+/** @copydoc tuneSerialThreshold */
+inline size_t tuneSerialThreshold(const Executor& exec, size_t maxSize = 1 << 14)
+{
+    return std::visit([maxSize](const auto& e) { return tuneSerialThreshold(e, maxSize); }, exec);
+}
+
+/**
+ * @brief Add to a value which other indices of a kernel may update, e.g. the cell of a face.
+ *
+ * Kernels of the SerialExecutor run on a single thread and add without atomics, so operators
+ * templated on the executor type need a single kernel for all executors.
+ *
+ * @tparam ExecutorType The concrete executor the kernel runs on.
+ */
+template<typename ExecutorType, typename ValueType>
+KOKKOS_INLINE_FUNCTION void scatterAdd(ValueType& target, const ValueType& value)
+{
+    if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+    {
+        target += value;
+    }
+    else
+    {
+        Kokkos::atomic_add(&target, value);
+    }
+}
+
+/**
+ * @brief Subtract from a value which other indices of a kernel may update, see scatterAdd.
+ */
+template<typename ExecutorType, typename ValueType>
+KOKKOS_INLINE_FUNCTION void scatterSub(ValueType& target, const ValueType& value)
+{
+    if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+    {
+        target -= value;
+    }
+    else
+    {
+        Kokkos::atomic_sub(&target, value);
+    }
+}
+
 template<typename Executor, parallelForKernel Kernel>
 void parallelFor(
-    [[maybe_unused]] const Executor& exec, std::pair<size_t, size_t> range, Kernel kernel
+    [[maybe_unused]] const Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    const std::string& name = "parallelFor"
 )
 {
+    if (auto* recording = detail::kernelRecording())
+    {
+        recording->launches.push_back([exec, range, kernel, name]()
+                                      { parallelFor(exec, range, kernel, name); });
+    }
     auto [start, end] = range;
     if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
     {
@@ -36,22 +689,74 @@ void parallelFor(
             kernel(i);
         }
     }
+    else if (detail::runInline<Executor>(end - start))
+    {
+        for (size_t i = start; i < end; i++)
+        {
+            kernel(i);
+        }
+    }
     else
     {
-        using runOn = typename Executor::exec;
-        Kokkos::parallel_for(
-            "parallelFor",
-            Kokkos::RangePolicy<runOn>(start, end),
-            KOKKOS_LAMBDA(const size_t i) { kernel(i); }
+        detail::launchFor<Executor>(
+            name, start, end, KOKKOS_LAMBDA(const size_t i) { kernel(i); }
         );
     }
 }
 
 
 template<parallelForKernel Kernel>
-void parallelFor(const NeoFOAM::Executor& exec, std::pair<size_t, size_t> range, Kernel kernel)
+void parallelFor(
+    const NeoFOAM::Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    const std::string& name = "parallelFor"
+)
+{
+    std::visit([&](const auto& e) { parallelFor(e, range, kernel, name); }, exec);
+}
+
+/**
+ * @brief Run a kernel on batches of Width consecutive indices and on the remaining indices one by
+ * one.
+ *
+ * The batch kernel processes the indices first, ..., first + Width - 1, e.g. with VectorBatch and
+ * ScalarBatch, so that the compiler can vectorize across indices. The remainder at the end of the
+ * range is processed by the kernel of a single index. With a Width of 1, see batchWidth, only the
+ * kernel of a single index runs.
+ *
+ * @tparam Width The number of indices per batch.
+ * @param exec The concrete executor to run the kernels on.
+ * @param range The range of indices.
+ * @param batchKernel The kernel of a batch, void(const size_t first).
+ * @param kernel The kernel of a single index, void(const size_t i), with the same results.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<size_t Width, typename Executor, typename BatchKernel, parallelForKernel Kernel>
+void parallelForBatches(
+    const Executor& exec,
+    std::pair<size_t, size_t> range,
+    [[maybe_unused]] BatchKernel batchKernel,
+    Kernel kernel,
+    const std::string& name = "parallelForBatches"
+)
 {
-    std::visit([&](const auto& e) { parallelFor(e, range, kernel); }, exec);
+    if constexpr (Width == 1)
+    {
+        parallelFor(exec, range, kernel, name);
+    }
+    else
+    {
+        auto [start, end] = range;
+        const size_t nBatches = (end - start) / Width;
+        parallelFor(
+            exec,
+            {0, nBatches},
+            KOKKOS_LAMBDA(const size_t batchi) { batchKernel(start + batchi * Width); },
+            name
+        );
+        parallelFor(exec, {start + nBatches * Width, end}, kernel, name + "::remainder");
+    }
 }
 
 // Concept to check if a callable is compatible with ValueType(const size_t)
@@ -63,9 +768,23 @@ concept parallelForFieldKernel = requires(Kernel t, ValueType val, size_t i) {
 };
 
 template<typename Executor, typename ValueType, parallelForFieldKernel<ValueType> Kernel>
-void parallelFor([[maybe_unused]] const Executor& exec, Field<ValueType>& field, Kernel kernel)
+void parallelFor(
+    [[maybe_unused]] const Executor& exec,
+    Field<ValueType>& field,
+    Kernel kernel,
+    const std::string& name = "parallelFor"
+)
 {
     auto span = field.span();
+    if (auto* recording = detail::kernelRecording())
+    {
+        // the replay must not depend on the field object, which may be a temporary
+        auto fieldKernel = KOKKOS_LAMBDA(const size_t i) { span[i] = kernel(i); };
+        recording->launches.push_back(
+            [exec, size = field.size(), fieldKernel, name]()
+            { parallelFor(exec, {0, size}, fieldKernel, name); }
+        );
+    }
     if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
     {
         for (size_t i = 0; i < field.size(); i++)
@@ -73,138 +792,258 @@ void parallelFor([[maybe_unused]] const Executor& exec, Field<ValueType>& field,
             span[i] = kernel(i);
         }
     }
+    else if (detail::runInline<Executor>(field.size()))
+    {
+        for (size_t i = 0; i < field.size(); i++)
+        {
+            span[i] = kernel(i);
+        }
+    }
     else
     {
-        using runOn = typename Executor::exec;
-        Kokkos::parallel_for(
-            "parallelFor",
-            Kokkos::RangePolicy<runOn>(0, field.size()),
-            KOKKOS_LAMBDA(const size_t i) { span[i] = kernel(i); }
+        detail::launchFor<Executor>(
+            name, 0, field.size(), KOKKOS_LAMBDA(const size_t i) { span[i] = kernel(i); }
         );
     }
 }
 
 template<typename ValueType, parallelForFieldKernel<ValueType> Kernel>
-void parallelFor(Field<ValueType>& field, Kernel kernel)
+void parallelFor(Field<ValueType>& field, Kernel kernel, const std::string& name = "parallelFor")
 {
-    std::visit([&](const auto& e) { parallelFor(e, field, kernel); }, field.exec());
+    std::visit([&](const auto& e) { parallelFor(e, field, kernel, name); }, field.exec());
 }
 
+/**
+ * @brief Reduce the contributions of a range of indices.
+ *
+ * In ReduceMode::reproducible the result does not depend on the executor or its number of threads,
+ * see detail::reproducibleReduce. Sums of floating point values are compensated within each block
+ * of indices, the kernel is then called with a zero initialised accumulator for each index.
+ *
+ * @param exec The executor to run the reduction on.
+ * @param range The range of indices.
+ * @param kernel The kernel accumulating the contribution of an index, void(const size_t i, T& acc).
+ * @param value The result or a Kokkos reducer.
+ * @param mode The reduction mode.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
 template<typename Executor, typename Kernel, typename T>
 void parallelReduce(
-    [[maybe_unused]] const Executor& exec, std::pair<size_t, size_t> range, Kernel kernel, T& value
+    [[maybe_unused]] const Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    T& value,
+    ReduceMode mode,
+    const std::string& name = "parallelReduce"
 )
 {
+    detail::recordUnsupported(name);
     auto [start, end] = range;
+    if (mode == ReduceMode::reproducible)
+    {
+        detail::reproducibleReduce<Executor>(start, end, kernel, value, name);
+        return;
+    }
     if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
     {
-        for (size_t i = start; i < end; i++)
-        {
-            if constexpr (Kokkos::is_reducer<T>::value)
-            {
-                kernel(i, value.reference());
-            }
-            else
-            {
-                kernel(i, value);
-            }
-        }
+        // initialise the result like the other executors
+        detail::inlineReduce(start, end, kernel, value);
+    }
+    else if (detail::runInline<Executor>(end - start))
+    {
+        detail::inlineReduce(start, end, kernel, value);
     }
     else
     {
-        using runOn = typename Executor::exec;
-        Kokkos::parallel_reduce(
-            "parallelReduce", Kokkos::RangePolicy<runOn>(start, end), kernel, value
-        );
+        detail::launchReduce<Executor>(name, start, end, kernel, value);
     }
 }
 
+template<typename Executor, typename Kernel, typename T>
+void parallelReduce(
+    const Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    T& value,
+    const std::string& name = "parallelReduce"
+)
+{
+    parallelReduce(exec, range, kernel, value, reduceMode(), name);
+}
+
+template<typename Kernel, typename T>
+void parallelReduce(
+    const NeoFOAM::Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    T& value,
+    ReduceMode mode,
+    const std::string& name = "parallelReduce"
+)
+{
+    return std::visit(
+        [&](const auto& e) { return parallelReduce(e, range, kernel, value, mode, name); }, exec
+    );
+}
+
 template<typename Kernel, typename T>
 void parallelReduce(
-    const NeoFOAM::Executor& exec, std::pair<size_t, size_t> range, Kernel kernel, T& value
+    const NeoFOAM::Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    T& value,
+    const std::string& name = "parallelReduce"
 )
 {
-    return std::visit([&](const auto& e) { return parallelReduce(e, range, kernel, value); }, exec);
+    parallelReduce(exec, range, kernel, value, reduceMode(), name);
 }
 
 
 template<typename Executor, typename ValueType, typename Kernel, typename T>
 void parallelReduce(
-    [[maybe_unused]] const Executor& exec, Field<ValueType>& field, Kernel kernel, T& value
+    [[maybe_unused]] const Executor& exec,
+    Field<ValueType>& field,
+    Kernel kernel,
+    T& value,
+    ReduceMode mode,
+    const std::string& name = "parallelReduce"
 )
 {
+    detail::recordUnsupported(name);
+    if (mode == ReduceMode::reproducible)
+    {
+        detail::reproducibleReduce<Executor>(0, field.size(), kernel, value, name);
+        return;
+    }
     if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
     {
-        for (size_t i = 0; i < field.size(); i++)
-        {
-            if constexpr (Kokkos::is_reducer<T>::value)
-            {
-                kernel(i, value.reference());
-            }
-            else
-            {
-                kernel(i, value);
-            }
-        }
+        // initialise the result like the other executors
+        detail::inlineReduce(size_t(0), field.size(), kernel, value);
+    }
+    else if (detail::runInline<Executor>(field.size()))
+    {
+        detail::inlineReduce(size_t(0), field.size(), kernel, value);
     }
     else
     {
-        using runOn = typename Executor::exec;
-        Kokkos::parallel_reduce(
-            "parallelReduce", Kokkos::RangePolicy<runOn>(0, field.size()), kernel, value
-        );
+        detail::launchReduce<Executor>(name, 0, field.size(), kernel, value);
     }
 }
 
+template<typename Executor, typename ValueType, typename Kernel, typename T>
+void parallelReduce(
+    const Executor& exec,
+    Field<ValueType>& field,
+    Kernel kernel,
+    T& value,
+    const std::string& name = "parallelReduce"
+)
+{
+    parallelReduce(exec, field, kernel, value, reduceMode(), name);
+}
+
 template<typename ValueType, typename Kernel, typename T>
-void parallelReduce(Field<ValueType>& field, Kernel kernel, T& value)
+void parallelReduce(
+    Field<ValueType>& field,
+    Kernel kernel,
+    T& value,
+    ReduceMode mode,
+    const std::string& name = "parallelReduce"
+)
 {
     return std::visit(
-        [&](const auto& e) { return parallelReduce(e, field, kernel, value); }, field.exec()
+        [&](const auto& e) { return parallelReduce(e, field, kernel, value, mode, name); },
+        field.exec()
     );
 }
 
+template<typename ValueType, typename Kernel, typename T>
+void parallelReduce(
+    Field<ValueType>& field, Kernel kernel, T& value, const std::string& name = "parallelReduce"
+)
+{
+    parallelReduce(field, kernel, value, reduceMode(), name);
+}
+
 template<typename Executor, typename Kernel>
 void parallelScan(
-    [[maybe_unused]] const Executor& exec, std::pair<size_t, size_t> range, Kernel kernel
+    [[maybe_unused]] const Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    const std::string& name = "parallelScan"
 )
 {
+    if (auto* recording = detail::kernelRecording())
+    {
+        recording->launches.push_back([exec, range, kernel, name]()
+                                      { parallelScan(exec, range, kernel, name); });
+    }
     auto [start, end] = range;
-    using runOn = typename Executor::exec;
-    Kokkos::parallel_scan("parallelScan", Kokkos::RangePolicy<runOn>(start, end), kernel);
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value
+                  && detail::serialScanKernel<Kernel>)
+    {
+        typename detail::ScanValue<decltype(&Kernel::operator())>::type update {};
+        for (size_t i = start; i < end; i++)
+        {
+            kernel(i, update, true);
+        }
+    }
+    else
+    {
+        detail::launchScan<Executor>(name, start, end, kernel);
+    }
 }
 
 template<typename Kernel>
-void parallelScan(const NeoFOAM::Executor& exec, std::pair<size_t, size_t> range, Kernel kernel)
+void parallelScan(
+    const NeoFOAM::Executor& exec,
+    std::pair<size_t, size_t> range,
+    Kernel kernel,
+    const std::string& name = "parallelScan"
+)
 {
-    std::visit([&](const auto& e) { parallelScan(e, range, kernel); }, exec);
+    std::visit([&](const auto& e) { parallelScan(e, range, kernel, name); }, exec);
 }
 
 template<typename Executor, typename Kernel, typename ReturnType>
+    requires(!std::is_convertible_v<ReturnType&, std::string>)
 void parallelScan(
     [[maybe_unused]] const Executor& exec,
     std::pair<size_t, size_t> range,
     Kernel kernel,
-    ReturnType& returnValue
+    ReturnType& returnValue,
+    const std::string& name = "parallelScan"
 )
 {
+    detail::recordUnsupported(name);
     auto [start, end] = range;
-    using runOn = typename Executor::exec;
-    Kokkos::parallel_scan(
-        "parallelScan", Kokkos::RangePolicy<runOn>(start, end), kernel, returnValue
-    );
+    if constexpr (std::is_same<std::remove_reference_t<Executor>, SerialExecutor>::value)
+    {
+        ReturnType update {};
+        for (size_t i = start; i < end; i++)
+        {
+            kernel(i, update, true);
+        }
+        returnValue = update;
+    }
+    else
+    {
+        detail::launchScan<Executor>(name, start, end, kernel, returnValue);
+    }
 }
 
 template<typename Kernel, typename ReturnType>
+    requires(!std::is_convertible_v<ReturnType&, std::string>)
 void parallelScan(
     const NeoFOAM::Executor& exec,
     std::pair<size_t, size_t> range,
     Kernel kernel,
-    ReturnType& returnValue
+    ReturnType& returnValue,
+    const std::string& name = "parallelScan"
 )
 {
     return std::visit(
-        [&](const auto& e) { return parallelScan(e, range, kernel, returnValue); }, exec
+        [&](const auto& e) { return parallelScan(e, range, kernel, returnValue, name); }, exec
     );
 }
 
@@ -0,0 +1,276 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/profiling.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/primitives/label.hpp"
+#include "NeoFOAM/fields/field.hpp"
+
+namespace NeoFOAM
+{
+
+namespace detail
+{
+
+/**
+ * @brief Compute the position of each selected index among the selected indices.
+ *
+ * @param exec The executor to run the scan on.
+ * @param size The number of indices.
+ * @param selected The flag of an index, bool(const size_t i).
+ * @param positions The exclusive count of selected indices before each index, of size size.
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The number of selected indices.
+ */
+template<typename Selected>
+localIdx selectedPositions(
+    const Executor& exec,
+    size_t size,
+    Selected selected,
+    Field<localIdx>& positions,
+    const std::string& name
+)
+{
+    localIdx count = 0;
+    auto sPositions = positions.span();
+    parallelScan(
+        exec,
+        {0, size},
+        KOKKOS_LAMBDA(const size_t i, localIdx& update, const bool final) {
+            if (final)
+            {
+                sPositions[i] = update;
+            }
+            update += selected(i) ? 1 : 0;
+        },
+        count,
+        name
+    );
+    return count;
+}
+
+/**
+ * @brief Copy the selected values in order into a new field.
+ */
+template<typename ValueType, typename Selected>
+Field<ValueType> compact(const Field<ValueType>& in, Selected selected, const std::string& name)
+{
+    Field<localIdx> positions(in.exec(), in.size());
+    localIdx count = selectedPositions(in.exec(), in.size(), selected, positions, name);
+    Field<ValueType> result(in.exec(), count);
+    auto [sIn, sPositions, sResult] = spans(in, positions, result);
+    parallelFor(
+        in.exec(),
+        {0, in.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            if (selected(i))
+            {
+                sResult[sPositions[i]] = sIn[i];
+            }
+        },
+        name
+    );
+    return result;
+}
+
+}
+
+/**
+ * @brief Sort the values of a field in ascending order.
+ *
+ * @param field The field to sort.
+ * @param name The name of the profiling region around the sort.
+ */
+template<typename ValueType>
+void sort(Field<ValueType>& field, const std::string& name = "NeoFOAM::sort")
+{
+    Kokkos::Profiling::ScopedRegion region(name);
+    detail::recordUnsupported(name);
+    std::visit(
+        [&](const auto& exec)
+        {
+            using ExecutorType = std::decay_t<decltype(exec)>;
+            if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+            {
+                std::sort(field.data(), field.data() + field.size());
+            }
+            else
+            {
+                Kokkos::sort(
+                    typename ExecutorType::exec {},
+                    exec.createKokkosView(field.data(), field.size())
+                );
+            }
+        },
+        field.exec()
+    );
+}
+
+/**
+ * @brief Sort the values of a field by the keys of another field, both in place.
+ *
+ * The SerialExecutor keeps the order of equal keys, the Kokkos backends, e.g. a radix sort on
+ * GPUs, may not.
+ *
+ * @param keys The keys to sort by, in ascending order.
+ * @param values The values reordered like the keys, of the size of the keys.
+ * @param name The name of the profiling region around the sort.
+ */
+template<typename KeyType, typename ValueType>
+void sortByKey(
+    Field<KeyType>& keys, Field<ValueType>& values, const std::string& name = "NeoFOAM::sortByKey"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(keys, values);
+    Kokkos::Profiling::ScopedRegion region(name);
+    detail::recordUnsupported(name);
+    std::visit(
+        [&](const auto& exec)
+        {
+            using ExecutorType = std::decay_t<decltype(exec)>;
+            if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+            {
+                std::vector<size_t> order(keys.size());
+                std::iota(order.begin(), order.end(), 0);
+                const KeyType* k = keys.data();
+                std::stable_sort(
+                    order.begin(), order.end(), [k](size_t a, size_t b) { return k[a] < k[b]; }
+                );
+                std::vector<KeyType> sortedKeys(keys.size());
+                std::vector<ValueType> sortedValues(keys.size());
+                for (size_t i = 0; i < order.size(); i++)
+                {
+                    sortedKeys[i] = keys.data()[order[i]];
+                    sortedValues[i] = values.data()[order[i]];
+                }
+                std::copy(sortedKeys.begin(), sortedKeys.end(), keys.data());
+                std::copy(sortedValues.begin(), sortedValues.end(), values.data());
+            }
+            else
+            {
+                Kokkos::Experimental::sort_by_key(
+                    typename ExecutorType::exec {},
+                    exec.createKokkosView(keys.data(), keys.size()),
+                    exec.createKokkosView(values.data(), values.size())
+                );
+            }
+        },
+        keys.exec()
+    );
+}
+
+/**
+ * @brief Copy the values fulfilling a predicate in order into a new field.
+ *
+ * @param in The values to select from.
+ * @param predicate The predicate, bool(const ValueType& value).
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The selected values on the executor of the input.
+ */
+template<typename ValueType, typename Predicate>
+Field<ValueType> copyIf(
+    const Field<ValueType>& in, const Predicate predicate, const std::string& name = "NeoFOAM::copyIf"
+)
+{
+    auto sIn = in.span();
+    return detail::compact(
+        in, KOKKOS_LAMBDA(const size_t i) { return predicate(sIn[i]); }, name
+    );
+}
+
+/**
+ * @brief Remove consecutive duplicates, i.e. all duplicates of a sorted field.
+ *
+ * @param in The values, usually sorted.
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The first value of each run of equal values on the executor of the input.
+ */
+template<typename ValueType>
+Field<ValueType> unique(const Field<ValueType>& in, const std::string& name = "NeoFOAM::unique")
+{
+    auto sIn = in.span();
+    return detail::compact(
+        in, KOKKOS_LAMBDA(const size_t i) { return i == 0 || sIn[i] != sIn[i - 1]; }, name
+    );
+}
+
+/**
+ * @brief Reorder a field so that the values fulfilling a predicate come first, keeping the order
+ * within both parts.
+ *
+ * @param field The field to partition.
+ * @param predicate The predicate, bool(const ValueType& value).
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The number of values fulfilling the predicate.
+ */
+template<typename ValueType, typename Predicate>
+size_t stablePartition(
+    Field<ValueType>& field,
+    const Predicate predicate,
+    const std::string& name = "NeoFOAM::stablePartition"
+)
+{
+    Field<localIdx> positions(field.exec(), field.size());
+    auto sField = field.span();
+    const localIdx nSelected = detail::selectedPositions(
+        field.exec(),
+        field.size(),
+        KOKKOS_LAMBDA(const size_t i) { return predicate(sField[i]); },
+        positions,
+        name
+    );
+    Field<ValueType> partitioned(field.exec(), field.size());
+    auto [sPositions, sPartitioned] = spans(positions, partitioned);
+    parallelFor(
+        field.exec(),
+        {0, field.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            // the values not selected follow in order after the selected ones
+            const size_t pos =
+                predicate(sField[i]) ? sPositions[i] : nSelected + (i - sPositions[i]);
+            sPartitioned[pos] = sField[i];
+        },
+        name
+    );
+    field = partitioned;
+    return nSelected;
+}
+
+/**
+ * @brief Count the occurrences of each bin index.
+ *
+ * @param bins The bin index of each entry, in [0, nBins).
+ * @param nBins The number of bins.
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The number of entries of each bin on the executor of the bins.
+ */
+template<typename IndexType>
+Field<localIdx> histogram(
+    const Field<IndexType>& bins, size_t nBins, const std::string& name = "NeoFOAM::histogram"
+)
+{
+    Field<localIdx> counts(bins.exec(), nBins, 0);
+    auto [sBins, sCounts] = spans(bins, counts);
+    parallelFor(
+        bins.exec(),
+        {0, bins.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            Kokkos::atomic_add(&sCounts[static_cast<size_t>(sBins[i])], localIdx(1));
+        },
+        name
+    );
+    return counts;
+}
+
+} // namespace NeoFOAM
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#pragma once
+
+#include <span>
+
+#include <Kokkos_Core.hpp> // IWYU pragma: keep
+
+#include "NeoFOAM/core/primitives/scalar.hpp"
+#include "NeoFOAM/core/primitives/vector.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief The number of consecutive indices batched kernels process per iteration on an executor.
+ *
+ * On the host a batch fills a cache line of scalars, which the compiler splits into the SIMD
+ * registers of the target. On devices neighbouring threads already run in lockstep, so a batch has
+ * a single lane.
+ */
+template<typename ExecutorType>
+constexpr size_t batchWidth()
+{
+    if constexpr (Kokkos::SpaceAccessibility<typename ExecutorType::exec, Kokkos::HostSpace>::
+                      accessible)
+    {
+        return 64 / sizeof(scalar);
+    }
+    else
+    {
+        return 1;
+    }
+}
+
+/**
+ * @class ScalarBatch
+ * @brief The scalars of Width consecutive indices, processed lane by lane in loops of fixed length
+ * which the compiler vectorizes.
+ * @ingroup primitives
+ */
+template<size_t Width>
+struct ScalarBatch
+{
+    scalar lane[Width];
+
+    /**
+     * @brief Load the values at first, ..., first + Width - 1.
+     */
+    KOKKOS_INLINE_FUNCTION
+    static ScalarBatch load(std::span<const scalar> values, size_t first)
+    {
+        ScalarBatch batch;
+        for (size_t l = 0; l < Width; l++)
+        {
+            batch.lane[l] = values[first + l];
+        }
+        return batch;
+    }
+
+    /**
+     * @brief Load the values at the indices stored at first, ..., first + Width - 1.
+     */
+    template<typename IndexType>
+    KOKKOS_INLINE_FUNCTION static ScalarBatch
+    gather(std::span<const scalar> values, std::span<const IndexType> indices, size_t first)
+    {
+        ScalarBatch batch;
+        for (size_t l = 0; l < Width; l++)
+        {
+            batch.lane[l] = values[static_cast<size_t>(indices[first + l])];
+        }
+        return batch;
+    }
+
+    /**
+     * @brief Store the lanes at first, ..., first + Width - 1.
+     */
+    KOKKOS_INLINE_FUNCTION
+    void store(std::span<scalar> values, size_t first) const
+    {
+        for (size_t l = 0; l < Width; l++)
+        {
+            values[first + l] = lane[l];
+        }
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    scalar operator[](const size_t l) const { return lane[l]; }
+
+    KOKKOS_INLINE_FUNCTION
+    scalar& operator[](const size_t l) { return lane[l]; }
+};
+
+/**
+ * @class VectorBatch
+ * @brief The Vectors of Width consecutive indices stored component by component.
+ *
+ * Kernels processing one Vector per index do not vectorize across indices, since the components
+ * of a Vector are stored next to each other. A VectorBatch transposes Width Vectors on loading, so
+ * the operations below act on Width lanes of x, y and z at once and give the same results as the
+ * operations of Vector.
+ * @ingroup primitives
+ */
+template<size_t Width>
+struct VectorBatch
+{
+    scalar x[Width];
+    scalar y[Width];
+    scalar z[Width];
+
+    /**
+     * @brief Load the Vectors at first, ..., first + Width - 1.
+     */
+    KOKKOS_INLINE_FUNCTION
+    static VectorBatch load(std::span<const Vector> values, size_t first)
+    {
+        VectorBatch batch;
+        for (size_t l = 0; l < Width; l++)
+        {
+            const Vector& value = values[first + l];
+            batch.x[l] = value[0];
+            batch.y[l] = value[1];
+            batch.z[l] = value[2];
+        }
+        return batch;
+    }
+
+    /**
+     * @brief Load the Vectors at the indices stored at first, ..., first + Width - 1.
+     */
+    template<typename IndexType>
+    KOKKOS_INLINE_FUNCTION static VectorBatch
+    gather(std::span<const Vector> values, std::span<const IndexType> indices, size_t first)
+    {
+        VectorBatch batch;
+        for (size_t l = 0; l < Width; l++)
+        {
+            const Vector& value = values[static_cast<size_t>(indices[first + l])];
+            batch.x[l] = value[0];
+            batch.y[l] = value[1];
+            batch.z[l] = value[2];
+        }
+        return batch;
+    }
+
+    /**
+     * @brief Store the lanes at first, ..., first + Width - 1.
+     */
+    KOKKOS_INLINE_FUNCTION
+    void store(std::span<Vector> values, size_t first) const
+    {
+        for (size_t l = 0; l < Width; l++)
+        {
+            values[first + l] = (*this)[l];
+        }
+    }
+
+    /**
+     * @brief Get the Vector of a lane.
+     */
+    KOKKOS_INLINE_FUNCTION
+    Vector operator[](const size_t l) const { return Vector(x[l], y[l], z[l]); }
+
+    KOKKOS_INLINE_FUNCTION
+    VectorBatch operator+(const VectorBatch& rhs) const
+    {
+        VectorBatch result;
+        for (size_t l = 0; l < Width; l++)
+        {
+            result.x[l] = x[l] + rhs.x[l];
+            result.y[l] = y[l] + rhs.y[l];
+            result.z[l] = z[l] + rhs.z[l];
+        }
+        return result;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    VectorBatch operator-(const VectorBatch& rhs) const
+    {
+        VectorBatch result;
+        for (size_t l = 0; l < Width; l++)
+        {
+            result.x[l] = x[l] - rhs.x[l];
+            result.y[l] = y[l] - rhs.y[l];
+            result.z[l] = z[l] - rhs.z[l];
+        }
+        return result;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    VectorBatch operator*(const ScalarBatch<Width>& rhs) const
+    {
+        VectorBatch result;
+        for (size_t l = 0; l < Width; l++)
+        {
+            result.x[l] = x[l] * rhs.lane[l];
+            result.y[l] = y[l] * rhs.lane[l];
+            result.z[l] = z[l] * rhs.lane[l];
+        }
+        return result;
+    }
+
+    KOKKOS_INLINE_FUNCTION
+    VectorBatch operator*(const scalar& rhs) const
+    {
+        VectorBatch result;
+        for (size_t l = 0; l < Width; l++)
+        {
+            result.x[l] = x[l] * rhs;
+            result.y[l] = y[l] * rhs;
+            result.z[l] = z[l] * rhs;
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief The component wise product of the lanes, like operator& of Vector.
+ */
+template<size_t Width>
+KOKKOS_INLINE_FUNCTION VectorBatch<Width>
+operator&(const VectorBatch<Width>& lhs, const VectorBatch<Width>& rhs)
+{
+    VectorBatch<Width> result;
+    for (size_t l = 0; l < Width; l++)
+    {
+        result.x[l] = rhs.x[l] * lhs.x[l];
+        result.y[l] = rhs.y[l] * lhs.y[l];
+        result.z[l] = rhs.z[l] * lhs.z[l];
+    }
+    return result;
+}
+
+/**
+ * @brief The magnitude of each lane.
+ */
+template<size_t Width>
+KOKKOS_INLINE_FUNCTION ScalarBatch<Width> mag(const VectorBatch<Width>& vec)
+{
+    ScalarBatch<Width> result;
+    for (size_t l = 0; l < Width; l++)
+    {
+        result.lane[l] = sqrt(vec.x[l] * vec.x[l] + vec.y[l] * vec.y[l] + vec.z[l] * vec.z[l]);
+    }
+    return result;
+}
+
+} // namespace NeoFOAM
@@ -154,3 +154,15 @@ scalar mag(const Vector& vec) { return sqrt(vec[0] * vec[0] + vec[1] * vec[1] +
 std::ostream& operator<<(std::ostream& out, const Vector& vec);
 
 } // namespace NeoFOAM
+
+/**
+ * @brief The identities of the Kokkos sum and product reductions of Vectors, which are used by
+ * nested reductions in teams, e.g. by parallelReduceSegments.
+ */
+template<>
+struct Kokkos::reduction_identity<NeoFOAM::Vector>
+{
+    KOKKOS_FORCEINLINE_FUNCTION static NeoFOAM::Vector sum() { return NeoFOAM::Vector(0, 0, 0); }
+
+    KOKKOS_FORCEINLINE_FUNCTION static NeoFOAM::Vector prod() { return NeoFOAM::Vector(1, 1, 1); }
+};
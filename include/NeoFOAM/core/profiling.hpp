@@ -0,0 +1,287 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Kokkos_Profiling_ScopedRegion.hpp> // IWYU pragma: export
+
+#ifdef NF_WITH_MPI_SUPPORT
+#include <mpi.h>
+#endif
+
+namespace NeoFOAM::profiling
+{
+
+/**
+ * @brief The accumulated timings of a single region on this process.
+ */
+struct RegionStats
+{
+    std::string path;   ///< The names of the region and all its parents joined by '/'.
+    size_t depth {0};   ///< The nesting level of the region, zero for top level regions.
+    size_t count {0};   ///< The number of times the region has been entered.
+    double total {0.0}; ///< The accumulated time in seconds.
+    double min {0.0};   ///< The shortest call in seconds.
+    double max {0.0};   ///< The longest call in seconds.
+
+    /**
+     * @brief Get the average time of a call in seconds.
+     */
+    double avg() const { return count > 0 ? total / static_cast<double>(count) : 0.0; }
+
+    /**
+     * @brief Get the name of the region, ie. the last component of the path.
+     */
+    std::string name() const { return path.substr(path.find_last_of('/') + 1); }
+};
+
+/**
+ * @brief The timings of a single region aggregated over several ranks.
+ *
+ * The min, avg and max values are computed from the total time each rank spent in the region and
+ * hence expose the load imbalance between the ranks.
+ */
+struct AggregatedRegionStats
+{
+    std::string path;      ///< The names of the region and all its parents joined by '/'.
+    size_t depth {0};      ///< The nesting level of the region, zero for top level regions.
+    size_t nRanks {0};     ///< The number of ranks which entered the region.
+    size_t count {0};      ///< The number of calls summed over all ranks.
+    double minTotal {0.0}; ///< The smallest total time of all ranks in seconds.
+    double avgTotal {0.0}; ///< The average total time of all ranks in seconds.
+    double maxTotal {0.0}; ///< The largest total time of all ranks in seconds.
+};
+
+/**
+ * @class Profiler
+ * @brief A lightweight hierarchical timer collecting the time spent in named regions.
+ *
+ * Regions are opened with start and closed with stop, preferably through the ScopedTimer or the
+ * NF_PROFILE_SCOPE macro. A region opened while another one is open becomes its child, so that
+ * the same name can appear below different parents, e.g. solve/div and div.
+ * If fencing is enabled Kokkos::fence is called before the clock is read, so that asynchronous
+ * device kernels are attributed to the region that launched them.
+ *
+ * @note The profiler is meant to be used from the host thread only and is not thread safe.
+ */
+class Profiler
+{
+public:
+
+    /**
+     * @brief Get the process wide profiler.
+     */
+    static Profiler& instance();
+
+    Profiler(const Profiler&) = delete;
+
+    Profiler& operator=(const Profiler&) = delete;
+
+    /**
+     * @brief Prints and writes the requested reports, see setReportAtExit.
+     */
+    ~Profiler();
+
+    /**
+     * @brief Open a region as child of the currently open region.
+     * @param name The name of the region.
+     */
+    void start(const std::string& name);
+
+    /**
+     * @brief Close the most recently opened region and accumulate its timing.
+     */
+    void stop();
+
+    /**
+     * @brief Enable or disable a Kokkos::fence before reading the clock.
+     */
+    void setFence(bool fence) { fence_ = fence; }
+
+    /**
+     * @brief Check if the clock is read after a Kokkos::fence.
+     */
+    bool fence() const { return fence_; }
+
+    /**
+     * @brief Request a summary table on std::cout when the program exits.
+     * @param enable Whether to print the summary table.
+     * @param jsonFile If not empty, the summary is also written as JSON to this file.
+     * @note The report at exit only contains the timings of this rank. Call aggregate before
+     * MPI is finalised to obtain timings over all ranks.
+     */
+    void setReportAtExit(bool enable, const std::string& jsonFile = "");
+
+    /**
+     * @brief Remove all regions and their timings.
+     */
+    void reset();
+
+    /**
+     * @brief Get the timings of all regions in the order they were first entered.
+     */
+    const std::vector<RegionStats>& stats() const { return regions_; }
+
+    /**
+     * @brief Print the timings of all regions as an indented table.
+     * @param out The stream to print to.
+     */
+    void print(std::ostream& out = std::cout) const;
+
+    /**
+     * @brief Write the timings of all regions as a JSON array.
+     * @param out The stream to write to.
+     */
+    void writeJson(std::ostream& out) const;
+
+#ifdef NF_WITH_MPI_SUPPORT
+    /**
+     * @brief Aggregate the timings of all ranks of the communicator.
+     *
+     * This is a collective operation, the result is only complete on rank 0.
+     * @param comm The communicator containing the ranks to aggregate.
+     * @return The aggregated timings on rank 0, the timings of this rank on all other ranks.
+     */
+    std::vector<AggregatedRegionStats> aggregate(MPI_Comm comm) const
+    {
+        int rank, nRanks;
+        MPI_Comm_rank(comm, &rank);
+        MPI_Comm_size(comm, &nRanks);
+
+        std::string local = serialize(regions_);
+        int localSize = static_cast<int>(local.size());
+        std::vector<int> sizes(static_cast<size_t>(nRanks));
+        MPI_Gather(&localSize, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, comm);
+
+        std::vector<int> displs(static_cast<size_t>(nRanks), 0);
+        for (size_t i = 1; i < displs.size(); i++)
+        {
+            displs[i] = displs[i - 1] + sizes[i - 1];
+        }
+        std::string all(rank == 0 ? static_cast<size_t>(displs.back() + sizes.back()) : 0, ' ');
+        MPI_Gatherv(
+            local.data(),
+            localSize,
+            MPI_CHAR,
+            all.data(),
+            sizes.data(),
+            displs.data(),
+            MPI_CHAR,
+            0,
+            comm
+        );
+
+        if (rank != 0)
+        {
+            return merge({regions_});
+        }
+        std::vector<std::vector<RegionStats>> rankStats;
+        for (size_t i = 0; i < sizes.size(); i++)
+        {
+            rankStats.push_back(deserialize(
+                all.substr(static_cast<size_t>(displs[i]), static_cast<size_t>(sizes[i]))
+            ));
+        }
+        return merge(rankStats);
+    }
+#endif
+
+    /**
+     * @brief Combine the timings of several ranks region by region.
+     * @param rankStats The timings of each rank.
+     * @return The aggregated timings in the order the regions appear on the ranks.
+     */
+    static std::vector<AggregatedRegionStats>
+    merge(const std::vector<std::vector<RegionStats>>& rankStats);
+
+    /**
+     * @brief Print aggregated timings as an indented table.
+     * @param stats The aggregated timings.
+     * @param out The stream to print to.
+     */
+    static void print(const std::vector<AggregatedRegionStats>& stats, std::ostream& out);
+
+    /**
+     * @brief Write aggregated timings as a JSON array.
+     * @param stats The aggregated timings.
+     * @param out The stream to write to.
+     */
+    static void writeJson(const std::vector<AggregatedRegionStats>& stats, std::ostream& out);
+
+    /**
+     * @brief Convert timings to a plain text representation, one region per line.
+     */
+    static std::string serialize(const std::vector<RegionStats>& stats);
+
+    /**
+     * @brief Restore timings from the representation created by serialize.
+     */
+    static std::vector<RegionStats> deserialize(const std::string& data);
+
+private:
+
+    Profiler() = default;
+
+    using clock = std::chrono::steady_clock;
+
+    struct OpenRegion
+    {
+        size_t index;
+        clock::time_point start;
+    };
+
+    std::vector<RegionStats> regions_;
+    std::unordered_map<std::string, size_t> index_;
+    std::vector<OpenRegion> open_;
+    bool fence_ {false};
+    bool reportAtExit_ {false};
+    std::string jsonFile_;
+};
+
+/**
+ * @class ScopedTimer
+ * @brief Times the enclosing scope as a region of the process wide profiler.
+ */
+class ScopedTimer
+{
+public:
+
+    /**
+     * @brief Open the region.
+     * @param name The name of the region.
+     */
+    explicit ScopedTimer(const std::string& name) { Profiler::instance().start(name); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+    /**
+     * @brief Close the region.
+     */
+    ~ScopedTimer() { Profiler::instance().stop(); }
+};
+
+} // namespace NeoFOAM::profiling
+
+#define NF_PROFILE_CONCAT_IMPL(a, b) a##b
+#define NF_PROFILE_CONCAT(a, b) NF_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef NF_WITH_PROFILING
+/**
+ * @def NF_PROFILE_SCOPE
+ * @brief Time the enclosing scope as a region with the given name.
+ *
+ * Expands to nothing unless NeoFOAM is configured with NEOFOAM_ENABLE_PROFILING, in which case the
+ * name expression is not evaluated either.
+ */
+#define NF_PROFILE_SCOPE(name)                                                                     \
+    NeoFOAM::profiling::ScopedTimer NF_PROFILE_CONCAT(nfScopedTimer, __LINE__)(name)
+#else
+#define NF_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -16,17 +16,18 @@ class Ddt : public OperatorMixin<FieldType>
 
 public:
 
-    Ddt(FieldType& field) : OperatorMixin<FieldType>(field.exec(), field, Operator::Type::Temporal)
-    {}
+    using ValueType = typename FieldType::FieldValueType;
+
+    Ddt(FieldType& field) : OperatorMixin<FieldType>(field.exec(), field, OperatorType::Temporal) {}
 
     std::string getName() const { return "TimeOperator"; }
 
-    void explicitOperation([[maybe_unused]] Field<scalar>& source, [[maybe_unused]] scalar scale)
+    void explicitOperation([[maybe_unused]] Field<ValueType>& source, [[maybe_unused]] scalar scale)
     {
         NF_ERROR_EXIT("Not implemented");
     }
 
-    void implicitOperation([[maybe_unused]] Field<scalar>& phi)
+    void implicitOperation([[maybe_unused]] Field<ValueType>& phi)
     {
         NF_ERROR_EXIT("Not implemented");
     }
@@ -18,10 +18,11 @@ namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
 namespace NeoFOAM::dsl::exp
 {
 
-Operator
-div(const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux, fvcc::VolumeField<NeoFOAM::scalar>& phi)
+template<typename ValueType>
+Operator<ValueType>
+div(const fvcc::SurfaceField<NeoFOAM::scalar>& faceFlux, fvcc::VolumeField<ValueType>& phi)
 {
-    return Operator(fvcc::DivOperator(dsl::Operator::Type::Explicit, faceFlux, phi));
+    return Operator<ValueType>(fvcc::DivOperator(dsl::OperatorType::Explicit, faceFlux, phi));
 }
 
 
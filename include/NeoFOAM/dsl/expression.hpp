@@ -10,11 +10,20 @@
 #include "NeoFOAM/fields/field.hpp"
 #include "NeoFOAM/dsl/operator.hpp"
 #include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/profiling.hpp"
 
 namespace NeoFOAM::dsl
 {
 
 
+/* @class Expression
+ * @brief A sum of operators acting on fields of a common value type
+ *
+ * @tparam ValueType The value type of the fields the operators act on
+ *
+ * @ingroup dsl
+ */
+template<typename ValueType>
 class Expression
 {
 public:
@@ -45,15 +54,17 @@ public:
     }
 
     /* @brief perform all explicit operation and accumulate the result */
-    Field<scalar> explicitOperation(size_t nCells)
+    Field<ValueType> explicitOperation(size_t nCells)
     {
-        Field<scalar> source(exec_, nCells, 0.0);
+        Field<ValueType> source(exec_, nCells, ValueType(0));
         return explicitOperation(source);
     }
 
     /* @brief perform all explicit operation and accumulate the result */
-    Field<scalar> explicitOperation(Field<scalar>& source)
+    Field<ValueType> explicitOperation(Field<ValueType>& source)
     {
+        Kokkos::Profiling::ScopedRegion region("NeoFOAM::Expression::explicitOperation");
+        NF_PROFILE_SCOPE("explicitOperation");
         for (auto& oper : explicitOperators_)
         {
             oper.explicitOperation(source);
@@ -61,17 +72,17 @@ public:
         return source;
     }
 
-    void addOperator(const Operator& oper)
+    void addOperator(const Operator<ValueType>& oper)
     {
         switch (oper.getType())
         {
-        case Operator::Type::Temporal:
+        case OperatorType::Temporal:
             temporalOperators_.push_back(oper);
             break;
-        case Operator::Type::Implicit:
+        case OperatorType::Implicit:
             implicitOperators_.push_back(oper);
             break;
-        case Operator::Type::Explicit:
+        case OperatorType::Explicit:
             explicitOperators_.push_back(oper);
             break;
         }
@@ -101,17 +112,17 @@ public:
     }
 
     // getters
-    const std::vector<Operator>& temporalOperators() const { return temporalOperators_; }
+    const std::vector<Operator<ValueType>>& temporalOperators() const { return temporalOperators_; }
 
-    const std::vector<Operator>& implicitOperators() const { return implicitOperators_; }
+    const std::vector<Operator<ValueType>>& implicitOperators() const { return implicitOperators_; }
 
-    const std::vector<Operator>& explicitOperators() const { return explicitOperators_; }
+    const std::vector<Operator<ValueType>>& explicitOperators() const { return explicitOperators_; }
 
-    std::vector<Operator>& temporalOperators() { return temporalOperators_; }
+    std::vector<Operator<ValueType>>& temporalOperators() { return temporalOperators_; }
 
-    std::vector<Operator>& implicitOperators() { return implicitOperators_; }
+    std::vector<Operator<ValueType>>& implicitOperators() { return implicitOperators_; }
 
-    std::vector<Operator>& explicitOperators() { return explicitOperators_; }
+    std::vector<Operator<ValueType>>& explicitOperators() { return explicitOperators_; }
 
     const Executor& exec() const { return exec_; }
 
@@ -119,36 +130,47 @@ private:
 
     const Executor exec_;
 
-    std::vector<Operator> temporalOperators_;
+    std::vector<Operator<ValueType>> temporalOperators_;
 
-    std::vector<Operator> implicitOperators_;
+    std::vector<Operator<ValueType>> implicitOperators_;
 
-    std::vector<Operator> explicitOperators_;
+    std::vector<Operator<ValueType>> explicitOperators_;
 };
 
-[[nodiscard]] inline Expression operator+(Expression lhs, const Expression& rhs)
+// instantiated in expression.cpp for both precisions
+extern template class Expression<float>;
+extern template class Expression<double>;
+
+template<typename ValueType>
+[[nodiscard]] Expression<ValueType>
+operator+(Expression<ValueType> lhs, const Expression<ValueType>& rhs)
 {
     lhs.addExpression(rhs);
     return lhs;
 }
 
-[[nodiscard]] inline Expression operator+(Expression lhs, const Operator& rhs)
+template<typename ValueType>
+[[nodiscard]] Expression<ValueType>
+operator+(Expression<ValueType> lhs, const Operator<ValueType>& rhs)
 {
     lhs.addOperator(rhs);
     return lhs;
 }
 
-[[nodiscard]] inline Expression operator+(const Operator& lhs, const Operator& rhs)
+template<typename ValueType>
+[[nodiscard]] Expression<ValueType>
+operator+(const Operator<ValueType>& lhs, const Operator<ValueType>& rhs)
 {
-    Expression expr(lhs.exec());
+    Expression<ValueType> expr(lhs.exec());
     expr.addOperator(lhs);
     expr.addOperator(rhs);
     return expr;
 }
 
-[[nodiscard]] inline Expression operator*(scalar scale, const Expression& es)
+template<typename ValueType>
+[[nodiscard]] Expression<ValueType> operator*(scalar scale, const Expression<ValueType>& es)
 {
-    Expression expr(es.exec());
+    Expression<ValueType> expr(es.exec());
     for (const auto& oper : es.temporalOperators())
     {
         expr.addOperator(scale * oper);
@@ -164,21 +186,27 @@ private:
     return expr;
 }
 
-[[nodiscard]] inline Expression operator-(Expression lhs, const Expression& rhs)
+template<typename ValueType>
+[[nodiscard]] Expression<ValueType>
+operator-(Expression<ValueType> lhs, const Expression<ValueType>& rhs)
 {
     lhs.addExpression(-1.0 * rhs);
     return lhs;
 }
 
-[[nodiscard]] inline Expression operator-(Expression lhs, const Operator& rhs)
+template<typename ValueType>
+[[nodiscard]] Expression<ValueType>
+operator-(Expression<ValueType> lhs, const Operator<ValueType>& rhs)
 {
     lhs.addOperator(-1.0 * rhs);
     return lhs;
 }
 
-[[nodiscard]] inline Expression operator-(const Operator& lhs, const Operator& rhs)
+template<typename ValueType>
+[[nodiscard]] Expression<ValueType>
+operator-(const Operator<ValueType>& lhs, const Operator<ValueType>& rhs)
 {
-    Expression expr(lhs.exec());
+    Expression<ValueType> expr(lhs.exec());
     expr.addOperator(lhs);
     expr.addOperator(Coeff(-1) * rhs);
     return expr;
@@ -17,6 +17,10 @@ namespace NeoFOAM::dsl::imp
 {
 
 
-Operator ddt(fvcc::VolumeField<NeoFOAM::scalar>& phi) { return dsl::temporal::ddt(phi); }
+template<typename ValueType>
+Operator<ValueType> ddt(fvcc::VolumeField<ValueType>& phi)
+{
+    return dsl::temporal::ddt(phi);
+}
 
 } // namespace NeoFOAM
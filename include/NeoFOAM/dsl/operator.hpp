@@ -8,25 +8,37 @@
 #include "NeoFOAM/core/primitives/scalar.hpp"
 #include "NeoFOAM/fields/field.hpp"
 #include "NeoFOAM/core/input.hpp"
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/dsl/coeff.hpp"
 
 namespace NeoFOAM::dsl
 {
 
-template<typename T>
+template<typename T, typename ValueType>
 concept HasTemporalOperator = requires(T t) {
     {
-        t.temporalOperation(std::declval<Field<scalar>&>(), std::declval<scalar>())
+        t.temporalOperation(std::declval<Field<ValueType>&>(), std::declval<scalar>())
     } -> std::same_as<void>; // Adjust return type and arguments as needed
 };
 
-template<typename T>
+template<typename T, typename ValueType>
 concept HasExplicitOperator = requires(T t) {
     {
-        t.explicitOperation(std::declval<Field<scalar>&>())
+        t.explicitOperation(std::declval<Field<ValueType>&>())
     } -> std::same_as<void>; // Adjust return type and arguments as needed
 };
 
+template<typename ValueType>
+class Expression;
+
+/* @brief the fundamental type of an operator, ie explicit, implicit, temporal */
+enum class OperatorType
+{
+    Temporal,
+    Implicit,
+    Explicit
+};
+
 /* @class Operator
  * @brief A class to represent an operator in NeoFOAMs dsl
  *
@@ -37,18 +49,17 @@ concept HasExplicitOperator = requires(T t) {
  * of Operators e.g Divergence, Laplacian, etc can be stored in a vector of
  * Operators
  *
+ * @tparam ValueType The value type of the fields the operator acts on, the coefficients are always
+ * given in scalar precision
+ *
  * @ingroup dsl
  */
+template<typename ValueType>
 class Operator
 {
 public:
 
-    enum class Type
-    {
-        Temporal,
-        Implicit,
-        Explicit
-    };
+    using Type = OperatorType;
 
     template<typename T>
     Operator(T cls) : model_(std::make_unique<OperatorModel<T>>(std::move(cls)))
@@ -58,9 +69,9 @@ public:
 
     Operator(Operator&& eqnOperator);
 
-    void explicitOperation(Field<scalar>& source);
+    void explicitOperation(Field<ValueType>& source);
 
-    void temporalOperation(Field<scalar>& field);
+    void temporalOperation(Field<ValueType>& field);
 
     /* returns the fundamental type of an operator, ie explicit, implicit, temporal */
     Operator::Type getType() const;
@@ -85,9 +96,9 @@ private:
     {
         virtual ~OperatorConcept() = default;
 
-        virtual void explicitOperation(Field<scalar>& source) = 0;
+        virtual void explicitOperation(Field<ValueType>& source) = 0;
 
-        virtual void temporalOperation(Field<scalar>& field) = 0;
+        virtual void temporalOperation(Field<ValueType>& field) = 0;
 
         /* @brief Given an input this function reads required coeffs */
         virtual void build(const Input& input) = 0;
@@ -121,18 +132,22 @@ private:
         /* returns the name of the operator */
         std::string getName() const override { return concreteOp_.getName(); }
 
-        virtual void explicitOperation(Field<scalar>& source) override
+        virtual void explicitOperation(Field<ValueType>& source) override
         {
-            if constexpr (HasExplicitOperator<ConcreteOperatorType>)
+            if constexpr (HasExplicitOperator<ConcreteOperatorType, ValueType>)
             {
+                Kokkos::Profiling::ScopedRegion region(concreteOp_.getName());
+                NF_PROFILE_SCOPE(concreteOp_.getName());
                 concreteOp_.explicitOperation(source);
             }
         }
 
-        virtual void temporalOperation(Field<scalar>& field) override
+        virtual void temporalOperation(Field<ValueType>& field) override
         {
-            if constexpr (HasTemporalOperator<ConcreteOperatorType>)
+            if constexpr (HasTemporalOperator<ConcreteOperatorType, ValueType>)
             {
+                Kokkos::Profiling::ScopedRegion region(concreteOp_.getName());
+                NF_PROFILE_SCOPE(concreteOp_.getName());
                 concreteOp_.temporalOperation(field);
             }
         }
@@ -165,19 +180,23 @@ private:
 };
 
 
-Operator operator*(scalar scalarCoeff, Operator rhs);
+template<typename ValueType>
+Operator<ValueType> operator*(scalar scalarCoeff, Operator<ValueType> rhs);
 
-Operator operator*(const Field<scalar>& coeffField, Operator rhs);
+template<typename ValueType>
+Operator<ValueType> operator*(const Field<scalar>& coeffField, Operator<ValueType> rhs);
 
-Operator operator*(const Coeff& coeff, Operator rhs);
+template<typename ValueType>
+Operator<ValueType> operator*(const Coeff& coeff, Operator<ValueType> rhs);
 
-template<typename CoeffFunction>
+template<typename ValueType, typename CoeffFunction>
     requires std::invocable<CoeffFunction&, size_t>
-Operator operator*([[maybe_unused]] CoeffFunction coeffFunc, const Operator& lhs)
+Operator<ValueType>
+operator*([[maybe_unused]] CoeffFunction coeffFunc, const Operator<ValueType>& lhs)
 {
     // TODO implement
     NF_ERROR_EXIT("Not implemented");
-    Operator result = lhs;
+    Operator<ValueType> result = lhs;
     // if (!result.getCoefficient().useSpan)
     // {
     //     result.setField(std::make_shared<Field<scalar>>(result.exec(), result.nCells(), 1.0));
@@ -198,10 +217,12 @@ class OperatorMixin
 
 public:
 
-    OperatorMixin(const Executor exec, FieldType& field, Operator::Type type)
+    using ValueType = typename FieldType::FieldValueType;
+
+    OperatorMixin(const Executor exec, FieldType& field, OperatorType type)
         : exec_(exec), coeffs_(), field_(field), type_(type) {};
 
-    Operator::Type getType() const { return type_; }
+    OperatorType getType() const { return type_; }
 
     virtual ~OperatorMixin() = default;
 
@@ -218,6 +239,49 @@ public:
     /* @brief Given an input this function reads required coeffs */
     void build([[maybe_unused]] const Input& input) {}
 
+    /* The dsl arithmetic of concrete operators, found by argument dependent lookup. The operators
+     * of Operator and Expression deduce the value type, which does not consider the conversion of a
+     * concrete operator to Operator<ValueType>. */
+    friend Operator<ValueType> operator*(scalar scale, const Operator<ValueType>& rhs)
+    {
+        return scale * rhs;
+    }
+
+    friend Operator<ValueType>
+    operator*(const Field<scalar>& coeffField, const Operator<ValueType>& rhs)
+    {
+        return coeffField * rhs;
+    }
+
+    friend Operator<ValueType> operator*(const Coeff& coeff, const Operator<ValueType>& rhs)
+    {
+        return coeff * rhs;
+    }
+
+    friend Expression<ValueType>
+    operator+(const Operator<ValueType>& lhs, const Operator<ValueType>& rhs)
+    {
+        return lhs + rhs;
+    }
+
+    friend Expression<ValueType>
+    operator-(const Operator<ValueType>& lhs, const Operator<ValueType>& rhs)
+    {
+        return lhs - rhs;
+    }
+
+    friend Expression<ValueType>
+    operator+(Expression<ValueType> lhs, const Operator<ValueType>& rhs)
+    {
+        return lhs + rhs;
+    }
+
+    friend Expression<ValueType>
+    operator-(Expression<ValueType> lhs, const Operator<ValueType>& rhs)
+    {
+        return lhs - rhs;
+    }
+
 protected:
 
     const Executor exec_; //!< Executor associated with the field. (CPU, GPU, openMP, etc.)
@@ -226,6 +290,11 @@ protected:
 
     FieldType& field_;
 
-    Operator::Type type_;
+    OperatorType type_;
 };
+
+// instantiated in operator.cpp for both precisions
+extern template class Operator<float>;
+extern template class Operator<double>;
+
 } // namespace NeoFOAM::dsl
@@ -27,9 +27,9 @@ namespace NeoFOAM::dsl
  * @param fvSchemes - Dictionary containing spatial operator and time  integration properties
  * @param fvSolution - Dictionary containing linear solver properties
  */
-template<typename FieldType>
+template<typename ValueType, typename FieldType>
 void solve(
-    Expression& exp,
+    Expression<ValueType>& exp,
     FieldType& solution,
     scalar t,
     scalar dt,
@@ -3,6 +3,12 @@
 
 
 #include "fields/boundaryFields.hpp"
+#include "fields/comparison.hpp"
 #include "fields/domainField.hpp"
+#include "fields/dualField.hpp"
 #include "fields/field.hpp"
+#include "fields/fieldTransfer.hpp"
 #include "fields/fieldTypeDefs.hpp"
+#include "fields/mask.hpp"
+#include "fields/operations/sum.hpp"
+#include "fields/storageField.hpp"
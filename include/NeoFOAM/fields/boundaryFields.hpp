@@ -5,11 +5,14 @@
 #include <Kokkos_Core.hpp>
 
 #include <iostream>
+#include <vector>
 
 #include "NeoFOAM/core/primitives/label.hpp"
 #include "NeoFOAM/core/primitives/scalar.hpp"
 #include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/dualField.hpp"
 #include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/fields/segmentedField.hpp"
 
 namespace NeoFOAM
 {
@@ -63,6 +66,16 @@ public:
           nBoundaries_(nBoundaries), nBoundaryFaces_(nBoundaryFaces)
     {}
 
+    /**
+     * @brief Create the boundary fields for the patches described by the given offsets.
+     * @param exec The executor on which the fields are stored.
+     * @param offsets The start of each patch followed by the total number of boundary faces, an
+     * empty vector for a domain without boundaries.
+     */
+    BoundaryFields(const Executor& exec, const std::vector<localIdx>& offsets)
+        : BoundaryFields(exec, offsets.empty() ? std::vector<localIdx> {0} : offsets, 0)
+    {}
+
 
     /** @copydoc BoundaryFields::value()*/
     const NeoFOAM::Field<T>& value() const { return value_; }
@@ -111,7 +124,7 @@ public:
      * @brief Get the view storing the offsets of each boundary.
      * @return The view storing the offsets of each boundary.
      */
-    const NeoFOAM::Field<localIdx>& offset() const { return offset_; }
+    const NeoFOAM::Field<localIdx>& offset() const { return offset_.field(); }
 
     /**
      * @brief Get the number of boundaries.
@@ -125,7 +138,7 @@ public:
      */
     size_t nBoundaryFaces() const { return nBoundaryFaces_; }
 
-    const Executor& exec() { return exec_; }
+    const Executor& exec() const { return exec_; }
 
     /**
      * @brief Get the range for a given patchId
@@ -133,11 +146,20 @@ public:
      */
     std::pair<localIdx, localIdx> range(localIdx patchId) const
     {
-        return {offset_.data()[patchId], offset_.data()[patchId + 1]};
+        auto offsets = offset_.hostSpan();
+        return {offsets[patchId], offsets[patchId + 1]};
     }
 
 private:
 
+    /* @brief Construct from non-empty offsets, the tag distinguishes it from the public overload */
+    BoundaryFields(const Executor& exec, const std::vector<localIdx>& offsets, int)
+        : exec_(exec), value_(exec, offsets.back()), refValue_(exec, offsets.back()),
+          valueFraction_(exec, offsets.back()), refGrad_(exec, offsets.back()),
+          boundaryTypes_(exec, offsets.size() - 1), offset_(exec, offsets),
+          nBoundaries_(offsets.size() - 1), nBoundaryFaces_(offsets.back())
+    {}
+
     Executor exec_;                        ///< The executor on which the field is stored
     NeoFOAM::Field<T> value_;              ///< The Field storing the computed values from the
                                            ///< boundary condition.
@@ -146,9 +168,61 @@ private:
                                            ///< the boundary value.
     NeoFOAM::Field<T> refGrad_;            ///< The Field storing the Neumann boundary values.
     NeoFOAM::Field<int> boundaryTypes_;    ///< The Field storing the boundary types.
-    NeoFOAM::Field<localIdx> offset_;      ///< The Field storing the offsets of each boundary.
+    DualField<localIdx> offset_;           ///< The offsets of each boundary, mirrored on the host.
     size_t nBoundaries_;                   ///< The number of boundaries.
     size_t nBoundaryFaces_;                ///< The number of boundary faces.
 };
 
+/**
+ * @brief Sum the boundary values of each patch.
+ *
+ * All patches are reduced in a single kernel using the offsets of the boundary fields, the faces
+ * of a patch are shared by the threads of a team.
+ *
+ * @param bFields The boundary fields to sum.
+ * @return A field of size nBoundaries with the sum of each patch.
+ */
+template<typename ValueType>
+Field<ValueType> patchSum(const BoundaryFields<ValueType>& bFields)
+{
+    Field<ValueType> result(bFields.exec(), bFields.nBoundaries());
+    const auto values = bFields.value().span();
+    parallelReduceSegments(
+        bFields.exec(),
+        bFields.offset().span(),
+        KOKKOS_LAMBDA(const size_t i, ValueType& acc) { acc += values[i]; },
+        result.span(),
+        "NeoFOAM::patchSum"
+    );
+    return result;
+}
+
+/**
+ * @brief Integrate the boundary values of each patch with given face weights.
+ *
+ * Computes sum(value * weight) for each patch, e.g. the pressure force sum(p * Sf) or the mass flow
+ * sum(phi * magSf). All patches are reduced in a single kernel with one team per patch.
+ *
+ * @param bFields The boundary fields to integrate.
+ * @param weights The per boundary face weights, e.g. the boundary face area vectors.
+ * @return A field of size nBoundaries with the integral of each patch.
+ */
+template<typename ValueType, typename WeightType>
+auto patchIntegrate(const BoundaryFields<ValueType>& bFields, const Field<WeightType>& weights)
+{
+    using ResultType = decltype(std::declval<ValueType>() * std::declval<WeightType>());
+    NF_ASSERT_EQUAL(weights.size(), bFields.nBoundaryFaces());
+    Field<ResultType> result(bFields.exec(), bFields.nBoundaries());
+    const auto values = bFields.value().span();
+    const auto sWeights = weights.span();
+    parallelReduceSegments(
+        bFields.exec(),
+        bFields.offset().span(),
+        KOKKOS_LAMBDA(const size_t i, ResultType& acc) { acc += values[i] * sWeights[i]; },
+        result.span(),
+        "NeoFOAM::patchIntegrate"
+    );
+    return result;
+}
+
 }
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/primitives/scalar.hpp"
+#include "NeoFOAM/core/primitives/vector.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/helpers/exceptions.hpp"
+
+namespace NeoFOAM
+{
+
+namespace detail
+{
+
+template<typename ValueType>
+KOKKOS_INLINE_FUNCTION scalar magnitude(const ValueType& value)
+{
+    if constexpr (std::is_arithmetic_v<ValueType>)
+    {
+        return value < 0 ? -value : value;
+    }
+    else
+    {
+        return mag(value);
+    }
+}
+
+/**
+ * @brief Map the bits of a floating point value to an integer which is ordered like the values.
+ */
+template<typename ValueType>
+KOKKOS_INLINE_FUNCTION auto orderedBits(ValueType value)
+{
+    using Int = std::conditional_t<sizeof(ValueType) == 8, int64_t, int32_t>;
+    const Int bits = Kokkos::bit_cast<Int>(value);
+    // negative values are stored as sign and magnitude, mirror them below zero
+    return static_cast<int64_t>(bits < 0 ? std::numeric_limits<Int>::min() - bits : bits);
+}
+
+KOKKOS_INLINE_FUNCTION uint64_t mix(uint64_t h)
+{
+    // the finaliser of splitmix64
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    return h ^ (h >> 31);
+}
+
+/**
+ * @brief Hash the bytes of a value at a given index.
+ */
+template<typename ValueType>
+KOKKOS_INLINE_FUNCTION uint64_t hashValue(const ValueType& value, size_t i)
+{
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+    uint64_t h = mix(static_cast<uint64_t>(i) + 0x9e3779b97f4a7c15ULL);
+    for (size_t b = 0; b < sizeof(ValueType); b += 8)
+    {
+        uint64_t word = 0;
+        for (size_t k = 0; k < 8 && b + k < sizeof(ValueType); k++)
+        {
+            word |= static_cast<uint64_t>(bytes[b + k]) << (8 * k);
+        }
+        h = mix(h ^ word);
+    }
+    return h;
+}
+
+}
+
+/**
+ * @brief The largest deviation between two fields and where it occurs.
+ */
+struct Deviation
+{
+    scalar value {0}; ///< The magnitude of the difference.
+    size_t index {0}; ///< The first index with the largest difference.
+};
+
+/**
+ * @brief Find the largest deviation between two fields in a single reduction.
+ *
+ * A NaN difference counts as an infinite deviation, so a field with NaNs never passes as close to
+ * a finite reference.
+ *
+ * @param a The field to check.
+ * @param b The reference field, of the size of a.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType>
+Deviation maxDeviation(
+    const Field<ValueType>& a,
+    const Field<std::type_identity_t<ValueType>>& b,
+    const std::string& name = "NeoFOAM::maxDeviation"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(a, b);
+    if (a.size() == 0)
+    {
+        return Deviation {};
+    }
+    // ties are broken by the lower index on all executors
+    using Reducer = Kokkos::MaxFirstLoc<scalar, size_t>;
+    typename Reducer::value_type result;
+    Reducer reducer(result);
+    reducer.init(result);
+    auto sA = a.span();
+    auto sB = b.span();
+    parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const size_t i, typename Reducer::value_type& acc) {
+            scalar deviation = detail::magnitude(sA[i] - sB[i]);
+            // a NaN compares false with everything, also in the join of the reducer
+            if (deviation != deviation)
+            {
+                deviation = Kokkos::Experimental::infinity_v<scalar>;
+            }
+            if (deviation > acc.val)
+            {
+                acc.val = deviation;
+                acc.loc = i;
+            }
+        },
+        reducer,
+        name
+    );
+    return Deviation {result.val, result.loc};
+}
+
+/**
+ * @brief Check that two fields agree within a tolerance in a single reduction.
+ *
+ * Each value has to fulfil |a - b| <= absTol + relTol * |b|.
+ *
+ * @param a The field to check.
+ * @param b The reference field, of the size of a.
+ * @param absTol The absolute tolerance.
+ * @param relTol The tolerance relative to the magnitude of the reference.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType>
+bool allClose(
+    const Field<ValueType>& a,
+    const Field<std::type_identity_t<ValueType>>& b,
+    scalar absTol,
+    scalar relTol = 0,
+    const std::string& name = "NeoFOAM::allClose"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(a, b);
+    size_t nViolations = 0;
+    auto sA = a.span();
+    auto sB = b.span();
+    parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const size_t i, size_t& acc) {
+            // written to count NaNs as violations
+            const bool close = detail::magnitude(sA[i] - sB[i])
+                            <= absTol + relTol * detail::magnitude(sB[i]);
+            acc += close ? 0 : 1;
+        },
+        nViolations,
+        name
+    );
+    return nViolations == 0;
+}
+
+/**
+ * @brief Compute the largest distance in units in the last place between two fields.
+ *
+ * A distance of zero means the fields are bitwise equal except for the sign of zeros, NaNs give
+ * large distances.
+ *
+ * @param a The field to check.
+ * @param b The reference field, of the size of a.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType>
+    requires std::is_floating_point_v<ValueType>
+uint64_t maxUlpDistance(
+    const Field<ValueType>& a,
+    const Field<std::type_identity_t<ValueType>>& b,
+    const std::string& name = "NeoFOAM::maxUlpDistance"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(a, b);
+    uint64_t result = 0;
+    Kokkos::Max<uint64_t> reducer(result);
+    auto sA = a.span();
+    auto sB = b.span();
+    parallelReduce(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const size_t i, uint64_t& acc) {
+            const int64_t ia = detail::orderedBits(sA[i]);
+            const int64_t ib = detail::orderedBits(sB[i]);
+            // the difference of two int64_t may overflow, unsigned arithmetic wraps
+            const uint64_t distance = ia >= ib ? static_cast<uint64_t>(ia) - static_cast<uint64_t>(ib)
+                                               : static_cast<uint64_t>(ib) - static_cast<uint64_t>(ia);
+            if (distance > acc)
+            {
+                acc = distance;
+            }
+        },
+        reducer,
+        name
+    );
+    return result;
+}
+
+/**
+ * @brief Hash the bits and positions of the values of a field in a single reduction.
+ *
+ * The checksum does not depend on the executor or the number of threads, so it can verify
+ * checkpoints and the consistency of decomposed fields. Values with different bits, e.g. 0.0 and
+ * -0.0, give different checksums.
+ *
+ * @param field The field to hash.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType>
+uint64_t checksum(const Field<ValueType>& field, const std::string& name = "NeoFOAM::checksum")
+{
+    uint64_t result = 0;
+    auto sField = field.span();
+    // the wrapping sum of the hashes is independent of the order
+    parallelReduce(
+        field.exec(),
+        {0, field.size()},
+        KOKKOS_LAMBDA(const size_t i, uint64_t& acc) { acc += detail::hashValue(sField[i], i); },
+        result,
+        name
+    );
+    return detail::mix(result ^ static_cast<uint64_t>(field.size()));
+}
+
+} // namespace NeoFOAM
@@ -5,6 +5,7 @@
 #include <Kokkos_Core.hpp>
 
 #include <iostream>
+#include <vector>
 
 #include "NeoFOAM/core/executor/executor.hpp"
 #include "NeoFOAM/core/primitives/label.hpp"
@@ -59,9 +60,21 @@ public:
           boundaryFields_(exec, nBoundaryFaces, nBoundaries)
     {}
 
+    DomainField(const Executor& exec, size_t nInternal, const std::vector<localIdx>& offsets)
+        : exec_(exec), internalField_(exec, nInternal), boundaryFields_(exec, offsets)
+    {}
+
+    DomainField(
+        const Executor& exec,
+        const Field<ValueType>& internalField,
+        const std::vector<localIdx>& offsets
+    )
+        : exec_(exec), internalField_(exec, internalField), boundaryFields_(exec, offsets)
+    {}
+
     DomainField(const Executor& exec, const UnstructuredMesh& mesh)
         : exec_(exec), internalField_(exec, mesh.nCells()),
-          boundaryFields_(exec, mesh.nBoundaryFaces(), mesh.nBoundaries())
+          boundaryFields_(exec, mesh.boundaryMesh().offset())
     {}
 
 
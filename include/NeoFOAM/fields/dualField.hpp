@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/field.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @class DualField
+ * @brief A field on an executor with a host mirror which is only updated when it is out of date.
+ *
+ * In the spirit of Kokkos::DualView, the side which changed the data is marked by modifyHost or
+ * modifyDevice, and syncHost or syncDevice copy the data only if the other side was modified.
+ * Fields in memory accessible from the host, e.g. of the SerialExecutor and the CPUExecutor,
+ * share their data with the mirror and never copy.
+ *
+ * @code
+ * DualField<scalar> T(exec, nCells);
+ * // write T.field() in kernels
+ * T.modifyDevice();
+ * T.syncHost(); // copies once, further calls are free until the next modifyDevice
+ * std::cout << T.hostSpan()[0];
+ * @endcode
+ */
+template<typename ValueType>
+class DualField
+{
+public:
+
+    /**
+     * @brief Create an uninitialized dual field.
+     * @param exec The executor of the device side.
+     * @param size The number of elements.
+     */
+    DualField(const Executor& exec, size_t size) : device_(exec, size), host_(mirror(device_)) {}
+
+    /**
+     * @brief Create a synchronised dual field from host data.
+     * @param exec The executor of the device side.
+     * @param in The values, copied to both sides.
+     */
+    DualField(const Executor& exec, const std::vector<ValueType>& in)
+        : device_(exec, in), host_(mirror(device_))
+    {
+        if (host_)
+        {
+            std::copy(in.begin(), in.end(), host_->data());
+        }
+    }
+
+    /**
+     * @brief Create a dual field from a field, the host mirror has to be synchronised before use.
+     * @param field The field of the device side.
+     */
+    explicit DualField(Field<ValueType> field)
+        : device_(std::move(field)), host_(mirror(device_)), modifiedDevice_(host_.has_value())
+    {}
+
+    /**
+     * @brief Copy a dual field to another executor, the copy is synchronised.
+     * @param exec The executor of the device side of the copy.
+     * @param rhs The dual field to copy, it must not have unsynchronised host modifications.
+     */
+    DualField(const Executor& exec, const DualField<ValueType>& rhs)
+        : device_(exec, rhs.device_), host_(mirror(device_))
+    {
+        NF_DEBUG_ASSERT(!rhs.needSyncDevice(), "Copying a DualField with host modifications");
+        if (host_)
+        {
+            device_.copyToHost(*host_);
+        }
+    }
+
+    /**
+     * @brief Get the device side, it is out of date if needSyncDevice.
+     */
+    const Field<ValueType>& field() const { return device_; }
+
+    /** @copydoc DualField::field() const */
+    Field<ValueType>& field() { return device_; }
+
+    /**
+     * @brief Get the host mirror, it is out of date if needSyncHost.
+     */
+    std::span<const ValueType> hostSpan() const
+    {
+        return host_ ? host_->span() : std::span<const ValueType>(device_.data(), device_.size());
+    }
+
+    /** @copydoc DualField::hostSpan() const */
+    std::span<ValueType> hostSpan()
+    {
+        return host_ ? host_->span() : std::span<ValueType>(device_.data(), device_.size());
+    }
+
+    const Executor& exec() const { return device_.exec(); }
+
+    size_t size() const { return device_.size(); }
+
+    /**
+     * @brief Check whether both sides share their data.
+     */
+    bool sharesMemory() const { return !host_; }
+
+    /**
+     * @brief Mark the host mirror as modified.
+     */
+    void modifyHost()
+    {
+        NF_DEBUG_ASSERT(!modifiedDevice_, "DualField modified on host and device without sync");
+        modifiedHost_ = host_.has_value();
+    }
+
+    /**
+     * @brief Mark the device side as modified.
+     */
+    void modifyDevice()
+    {
+        NF_DEBUG_ASSERT(!modifiedHost_, "DualField modified on host and device without sync");
+        modifiedDevice_ = host_.has_value();
+    }
+
+    bool needSyncHost() const { return modifiedDevice_; }
+
+    bool needSyncDevice() const { return modifiedHost_; }
+
+    /**
+     * @brief Copy the device side to the host mirror if it was modified.
+     */
+    void syncHost()
+    {
+        if (modifiedDevice_)
+        {
+            device_.copyToHost(*host_);
+            modifiedDevice_ = false;
+        }
+    }
+
+    /**
+     * @brief Copy the host mirror to the device side if it was modified.
+     */
+    void syncDevice()
+    {
+        if (modifiedHost_)
+        {
+            std::visit(
+                detail::deepCopyVisitor(device_.size(), host_->data(), device_.data()),
+                host_->exec(),
+                device_.exec()
+            );
+            modifiedHost_ = false;
+        }
+    }
+
+    /**
+     * @brief Discard the modifications, e.g. after both sides were written.
+     */
+    void clearSync()
+    {
+        modifiedHost_ = false;
+        modifiedDevice_ = false;
+    }
+
+private:
+
+    static std::optional<Field<ValueType>> mirror(const Field<ValueType>& device)
+    {
+        return std::visit(
+            [&](const auto& exec) -> std::optional<Field<ValueType>>
+            {
+                using ExecSpace = typename std::decay_t<decltype(exec)>::exec;
+                if constexpr (detail::onHost<ExecSpace>)
+                {
+                    return std::nullopt;
+                }
+                else
+                {
+                    return Field<ValueType>(SerialExecutor {}, device.size());
+                }
+            },
+            device.exec()
+        );
+    }
+
+    Field<ValueType> device_;
+    std::optional<Field<ValueType>> host_; ///< The mirror, empty if the device data is on the host.
+    bool modifiedHost_ {false};
+    bool modifiedDevice_ {false};
+};
+
+} // namespace NeoFOAM
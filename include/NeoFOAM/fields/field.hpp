@@ -195,7 +195,7 @@ public:
         NF_DEBUG_ASSERT(
             result.size() == size_, "Parsed Field size not the same as current field size"
         );
-        result = copyToExecutor(SerialExecutor());
+        std::visit(detail::deepCopyVisitor(size_, data_, result.data()), exec_, result.exec());
     }
 
     /**
@@ -4,9 +4,11 @@
 
 #include <tuple>
 #include <span>
+#include <string>
 
 #include <Kokkos_Core.hpp>
 #include "NeoFOAM/core/primitives/label.hpp"
+#include "NeoFOAM/core/executor/numa.hpp"
 #include "NeoFOAM/helpers/exceptions.hpp"
 #include "NeoFOAM/core/parallelAlgorithms.hpp"
 
@@ -24,9 +26,15 @@ class Field;
  * @param a The field to map.
  * @param inner The function to apply to each element of the field.
  * @param range The range to map the field in. If not provided, the whole field is mapped.
+ * @param name The kernel name reported to Kokkos Tools.
  */
 template<typename T, typename Inner>
-void map(Field<T>& a, const Inner inner, std::pair<size_t, size_t> range = {0, 0})
+void map(
+    Field<T>& a,
+    const Inner inner,
+    std::pair<size_t, size_t> range = {0, 0},
+    const std::string& name = "NeoFOAM::map"
+)
 {
     auto [start, end] = range;
     if (end == 0)
@@ -35,7 +43,7 @@ void map(Field<T>& a, const Inner inner, std::pair<size_t, size_t> range = {0, 0
     }
     auto spanA = a.span();
     parallelFor(
-        a.exec(), {start, end}, KOKKOS_LAMBDA(const size_t i) { spanA[i] = inner(i); }
+        a.exec(), {start, end}, KOKKOS_LAMBDA(const size_t i) { spanA[i] = inner(i); }, name
     );
 }
 
@@ -45,12 +53,14 @@ void map(Field<T>& a, const Inner inner, std::pair<size_t, size_t> range = {0, 0
  * @param field The field to fill.
  * @param value The scalar value to fill the field with.
  * @param range The range to fill the field in. If not provided, the whole field is filled.
+ * @param name The kernel name reported to Kokkos Tools.
  */
 template<typename ValueType>
 void fill(
     Field<ValueType>& a,
     const std::type_identity_t<ValueType> value,
-    std::pair<size_t, size_t> range = {0, 0}
+    std::pair<size_t, size_t> range = {0, 0},
+    const std::string& name = "NeoFOAM::fill"
 )
 {
     auto [start, end] = range;
@@ -60,7 +70,7 @@ void fill(
     }
     auto spanA = a.span();
     parallelFor(
-        a.exec(), {start, end}, KOKKOS_LAMBDA(const size_t i) { spanA[i] = value; }
+        a.exec(), {start, end}, KOKKOS_LAMBDA(const size_t i) { spanA[i] = value; }, name
     );
 }
 
@@ -71,12 +81,14 @@ void fill(
  * @param a The field to set.
  * @param b The span of values to set the field with.
  * @param range The range to set the field in. If not provided, the whole field is set.
+ * @param name The kernel name reported to Kokkos Tools.
  */
 template<typename ValueType>
 void setField(
     Field<ValueType>& a,
     const std::span<const std::type_identity_t<ValueType>> b,
-    std::pair<size_t, size_t> range = {0, 0}
+    std::pair<size_t, size_t> range = {0, 0},
+    const std::string& name = "NeoFOAM::setField"
 )
 {
     auto [start, end] = range;
@@ -86,16 +98,20 @@ void setField(
     }
     auto spanA = a.span();
     parallelFor(
-        a.exec(), {start, end}, KOKKOS_LAMBDA(const size_t i) { spanA[i] = b[i]; }
+        a.exec(), {start, end}, KOKKOS_LAMBDA(const size_t i) { spanA[i] = b[i]; }, name
     );
 }
 
 template<typename ValueType>
-void scalarMul(Field<ValueType>& a, const std::type_identity_t<ValueType> value)
+void scalarMul(
+    Field<ValueType>& a,
+    const std::type_identity_t<ValueType> value,
+    const std::string& name = "NeoFOAM::scalarMul"
+)
 {
     auto spanA = a.span();
     parallelFor(
-        a, KOKKOS_LAMBDA(const size_t i) { return spanA[i] * value; }
+        a, KOKKOS_LAMBDA(const size_t i) { return spanA[i] * value; }, name
     );
 }
 
@@ -103,14 +119,17 @@ namespace detail
 {
 template<typename ValueType, typename BinaryOp>
 void fieldBinaryOp(
-    Field<ValueType>& a, const Field<std::type_identity_t<ValueType>>& b, BinaryOp op
+    Field<ValueType>& a,
+    const Field<std::type_identity_t<ValueType>>& b,
+    BinaryOp op,
+    const std::string& name = "NeoFOAM::fieldBinaryOp"
 )
 {
     NeoFOAM_ASSERT_EQUAL_LENGTH(a, b);
     auto spanA = a.span();
     auto spanB = b.span();
     parallelFor(
-        a, KOKKOS_LAMBDA(const size_t i) { return op(spanA[i], spanB[i]); }
+        a, KOKKOS_LAMBDA(const size_t i) { return op(spanA[i], spanB[i]); }, name
     );
 }
 }
@@ -119,7 +138,7 @@ template<typename ValueType>
 void add(Field<ValueType>& a, const Field<std::type_identity_t<ValueType>>& b)
 {
     detail::fieldBinaryOp(
-        a, b, KOKKOS_LAMBDA(ValueType va, ValueType vb) { return va + vb; }
+        a, b, KOKKOS_LAMBDA(ValueType va, ValueType vb) { return va + vb; }, "NeoFOAM::add"
     );
 }
 
@@ -128,7 +147,7 @@ template<typename ValueType>
 void sub(Field<ValueType>& a, const Field<std::type_identity_t<ValueType>>& b)
 {
     detail::fieldBinaryOp(
-        a, b, KOKKOS_LAMBDA(ValueType va, ValueType vb) { return va - vb; }
+        a, b, KOKKOS_LAMBDA(ValueType va, ValueType vb) { return va - vb; }, "NeoFOAM::sub"
     );
 }
 
@@ -136,7 +155,7 @@ template<typename ValueType>
 void mul(Field<ValueType>& a, const Field<std::type_identity_t<ValueType>>& b)
 {
     detail::fieldBinaryOp(
-        a, b, KOKKOS_LAMBDA(ValueType va, ValueType vb) { return va * vb; }
+        a, b, KOKKOS_LAMBDA(ValueType va, ValueType vb) { return va * vb; }, "NeoFOAM::mul"
     );
 }
 
@@ -152,47 +171,59 @@ auto copyToHosts(Args&... fields)
     return std::make_tuple(fields.copyToHost()...);
 }
 
+/**
+ * @brief Check that all values of a field equal a value, in a single reduction on its executor.
+ */
 template<typename T>
-bool equal(Field<T>& field, T value)
+bool equal(const Field<T>& field, const std::type_identity_t<T> value)
 {
-    auto hostField = field.copyToHost();
-    auto hostSpan = hostField.span();
-    for (size_t i = 0; i < hostSpan.size(); i++)
-    {
-        if (hostSpan[i] != value)
-        {
-            return false;
-        }
-    }
-    return true;
+    size_t nDifferent = 0;
+    auto span = field.span();
+    parallelReduce(
+        field.exec(),
+        {0, field.size()},
+        KOKKOS_LAMBDA(const size_t i, size_t& acc) { acc += span[i] != value ? 1 : 0; },
+        nDifferent,
+        "NeoFOAM::equal"
+    );
+    return nDifferent == 0;
 };
 
+/**
+ * @brief Check that two fields are equal, in a single reduction on the executor of the first.
+ */
 template<typename T>
 bool equal(const Field<T>& field, const Field<T>& field2)
 {
-    auto [hostField, hostField2] = copyToHosts(field, field2);
-    auto [hostSpan, hostSpan2] = spans(hostField, hostField2);
-
-    if (hostSpan.size() != hostSpan2.size())
+    if (field.size() != field2.size())
     {
         return false;
     }
-
-    for (size_t i = 0; i < hostSpan.size(); i++)
+    if (field.exec() != field2.exec())
     {
-        if (hostSpan[i] != hostSpan2[i])
-        {
-            return false;
-        }
+        return equal(field, Field<T>(field.exec(), field2));
     }
 
-    return true;
+    size_t nDifferent = 0;
+    auto [span, span2] = spans(field, field2);
+    parallelReduce(
+        field.exec(),
+        {0, field.size()},
+        KOKKOS_LAMBDA(const size_t i, size_t& acc) { acc += span[i] != span2[i] ? 1 : 0; },
+        nDifferent,
+        "NeoFOAM::equal"
+    );
+    return nDifferent == 0;
 };
 
+/**
+ * @brief Check that a field equals host data, the field is copied to the host.
+ */
 template<typename T>
 bool equal(const Field<T>& field, std::span<T> span2)
 {
-    auto hostSpan = field.copyToHost().span();
+    auto hostField = field.copyToHost();
+    auto hostSpan = hostField.span();
 
     if (hostSpan.size() != span2.size())
     {
@@ -210,4 +241,30 @@ bool equal(const Field<T>& field, std::span<T> span2)
     return true;
 }
 
+/**
+ * @brief Report the NUMA nodes the pages of a field reside on.
+ *
+ * Fields in memory which is not accessible from the host, e.g. on a GPU, span no pages.
+ * @param field The field to query.
+ */
+template<typename ValueType>
+PagePlacement pagePlacement(const Field<ValueType>& field)
+{
+    return std::visit(
+        [&](const auto& exec)
+        {
+            using MemorySpace = typename std::remove_cvref_t<decltype(exec)>::exec::memory_space;
+            if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace, MemorySpace>::accessible)
+            {
+                return pagePlacement(field.data(), field.size() * sizeof(ValueType));
+            }
+            else
+            {
+                return PagePlacement {};
+            }
+        },
+        field.exec()
+    );
+}
+
 } // namespace NeoFOAM
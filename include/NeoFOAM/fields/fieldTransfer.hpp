@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/executor/staging.hpp"
+#include "NeoFOAM/fields/field.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief Start copying a field into another field of the same size on any executor.
+ *
+ * Copies between memory accessible from the host are done right away and return a completed
+ * event. Copies from or to device memory go through a page locked buffer of the StagingPool and
+ * are enqueued on the transferSpace, so the host and the executors continue while the data
+ * moves. A device to host copy is finished by wait, which moves the data from the staging buffer
+ * into dst. Neither src nor dst may be modified or destroyed before the event completed.
+ *
+ * Copying into an existing field every time step, e.g. for monitoring, costs no allocations
+ * once the pool holds a buffer of the size:
+ * @code
+ * Field<scalar> hostT(SerialExecutor {}, T.size());
+ * auto event = copyAsync(T, hostT);
+ * // launch further kernels
+ * event.wait();
+ * @endcode
+ *
+ * @param src The field to copy.
+ * @param dst The field to copy into, it must have the size of src.
+ * @return The event completing the copy.
+ */
+template<typename ValueType>
+[[nodiscard]] TransferEvent copyAsync(const Field<ValueType>& src, Field<ValueType>& dst)
+{
+    NF_ASSERT(
+        src.size() == dst.size(),
+        "Field sizes do not match, src: " << src.size() << " dst: " << dst.size()
+    );
+    const size_t size = src.size();
+    const ValueType* srcPtr = src.data();
+    ValueType* dstPtr = dst.data();
+    if (size == 0)
+    {
+        return TransferEvent();
+    }
+
+    return std::visit(
+        [size, srcPtr, dstPtr](const auto& srcExec, const auto& dstExec) -> TransferEvent
+        {
+            using SrcSpace = typename std::decay_t<decltype(srcExec)>::exec;
+            using DstSpace = typename std::decay_t<decltype(dstExec)>::exec;
+            auto srcView = srcExec.createKokkosView(srcPtr, size);
+            auto dstView = dstExec.createKokkosView(dstPtr, size);
+            const bool srcOnHost = detail::onHost<SrcSpace>;
+            const bool dstOnHost = detail::onHost<DstSpace>;
+            if (srcOnHost && dstOnHost)
+            {
+                Kokkos::deep_copy(dstView, srcView);
+                return TransferEvent();
+            }
+
+            // the transfer instance is not ordered after the kernels of the executors, which may
+            // still write src or read dst
+            if constexpr (!detail::onHost<SrcSpace>)
+            {
+                SrcSpace().fence("NeoFOAM::copyAsync::src");
+            }
+            if constexpr (!detail::onHost<DstSpace>)
+            {
+                DstSpace().fence("NeoFOAM::copyAsync::dst");
+            }
+            auto space = transferSpace();
+            if (!srcOnHost && !dstOnHost)
+            {
+                Kokkos::deep_copy(space, dstView, srcView);
+                return TransferEvent([space]() { space.fence("NeoFOAM::copyAsync"); });
+            }
+
+            // the completion returns the buffer to the pool
+            auto buffer = std::make_shared<StagingBuffer>(
+                StagingPool::instance().acquire(size * sizeof(ValueType))
+            );
+            Kokkos::View<ValueType*, PinnedSpace, Kokkos::MemoryUnmanaged> staging(
+                static_cast<ValueType*>(buffer->data()), size
+            );
+            if (dstOnHost)
+            {
+                Kokkos::deep_copy(space, staging, srcView);
+                return TransferEvent(
+                    [space, staging, dstPtr, size, buffer]() mutable
+                    {
+                        space.fence("NeoFOAM::copyAsync");
+                        std::copy_n(staging.data(), size, dstPtr);
+                        buffer.reset();
+                    }
+                );
+            }
+            std::copy_n(srcPtr, size, staging.data());
+            Kokkos::deep_copy(space, dstView, staging);
+            return TransferEvent(
+                [space, buffer]() mutable
+                {
+                    space.fence("NeoFOAM::copyAsync");
+                    buffer.reset();
+                }
+            );
+        },
+        src.exec(),
+        dst.exec()
+    );
+}
+
+/**
+ * @class PendingField
+ * @brief A field which is being filled by an asynchronous transfer.
+ */
+template<typename ValueType>
+class PendingField
+{
+public:
+
+    PendingField(Field<ValueType>&& field, TransferEvent&& event)
+        : field_(std::move(field)), event_(std::move(event))
+    {}
+
+    /**
+     * @brief Check whether get would have to wait for the transfer.
+     */
+    bool pending() const { return event_.pending(); }
+
+    /**
+     * @brief Wait for the transfer and get the field.
+     */
+    Field<ValueType>& get()
+    {
+        event_.wait();
+        return field_;
+    }
+
+private:
+
+    // declared first to be destroyed after the event completed the transfer into it
+    Field<ValueType> field_;
+    TransferEvent event_;
+};
+
+/**
+ * @brief Start copying a field to another executor ahead of its use there.
+ *
+ * The fields of the executors live in separate memory spaces and are not migrated on access, so
+ * prefetching allocates the destination and enqueues the copy right away. The copy overlaps with
+ * everything launched until PendingField::get is called.
+ *
+ * @param src The field to copy, it may not be modified before the transfer completed.
+ * @param dstExec The executor to copy the field to.
+ * @return The pending copy on dstExec.
+ */
+template<typename ValueType>
+[[nodiscard]] PendingField<ValueType> prefetch(const Field<ValueType>& src, const Executor& dstExec)
+{
+    Field<ValueType> dst(dstExec, src.size());
+    auto event = copyAsync(src, dst);
+    return PendingField<ValueType>(std::move(dst), std::move(event));
+}
+
+} // namespace NeoFOAM
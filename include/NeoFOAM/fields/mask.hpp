@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <string>
+
+#include <Kokkos_Core.hpp>
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/helpers/exceptions.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief Map the elements of a field where a mask is set, the others keep their value.
+ *
+ * @param a The field to map.
+ * @param inner The function to apply to each masked element of the field.
+ * @param mask The mask selecting the elements, it must have the size of the field.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename T, typename Inner>
+void map(
+    Field<T>& a, const Inner inner, const Field<bool>& mask, const std::string& name = "NeoFOAM::map"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(a, mask);
+    auto spanA = a.span();
+    auto spanMask = mask.span();
+    parallelFor(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            if (spanMask[i])
+            {
+                spanA[i] = inner(i);
+            }
+        },
+        name
+    );
+}
+
+/**
+ * @brief Fill the elements of a field where a mask is set with a value.
+ *
+ * @param a The field to fill.
+ * @param value The value to fill the masked elements with.
+ * @param mask The mask selecting the elements, it must have the size of the field.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType>
+void fill(
+    Field<ValueType>& a,
+    const std::type_identity_t<ValueType> value,
+    const Field<bool>& mask,
+    const std::string& name = "NeoFOAM::fill"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(a, mask);
+    auto spanA = a.span();
+    auto spanMask = mask.span();
+    parallelFor(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            if (spanMask[i])
+            {
+                spanA[i] = value;
+            }
+        },
+        name
+    );
+}
+
+/**
+ * @brief Create a mask which is set where the values of a field fulfil a predicate.
+ *
+ * @param a The field to test.
+ * @param predicate The predicate, bool(const ValueType& value).
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The mask on the executor of the field.
+ */
+template<typename ValueType, typename Predicate>
+Field<bool> mask(
+    const Field<ValueType>& a, const Predicate predicate, const std::string& name = "NeoFOAM::mask"
+)
+{
+    Field<bool> result(a.exec(), a.size());
+    auto spanResult = result.span();
+    auto spanA = a.span();
+    parallelFor(
+        a.exec(),
+        {0, a.size()},
+        KOKKOS_LAMBDA(const size_t i) { spanResult[i] = predicate(spanA[i]); },
+        name
+    );
+    return result;
+}
+
+/**
+ * @brief Select the values of one of two fields depending on a mask.
+ *
+ * @param mask The mask, set where the value of a is selected.
+ * @param a The values selected where the mask is set.
+ * @param b The values selected where the mask is not set.
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The selected values on the executor of the mask.
+ */
+template<typename ValueType>
+Field<ValueType> where(
+    const Field<bool>& mask,
+    const Field<ValueType>& a,
+    const Field<std::type_identity_t<ValueType>>& b,
+    const std::string& name = "NeoFOAM::where"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(mask, a);
+    NeoFOAM_ASSERT_EQUAL_LENGTH(mask, b);
+    Field<ValueType> result(mask.exec(), mask.size());
+    auto [spanResult, spanMask, spanA, spanB] = spans(result, mask, a, b);
+    parallelFor(
+        mask.exec(),
+        {0, mask.size()},
+        KOKKOS_LAMBDA(const size_t i) { spanResult[i] = spanMask[i] ? spanA[i] : spanB[i]; },
+        name
+    );
+    return result;
+}
+
+/**
+ * @brief Select the values of a field where a mask is set and a value elsewhere.
+ *
+ * @param mask The mask, set where the value of a is selected.
+ * @param a The values selected where the mask is set.
+ * @param b The value selected where the mask is not set.
+ * @param name The kernel name reported to Kokkos Tools.
+ * @return The selected values on the executor of the mask.
+ */
+template<typename ValueType>
+Field<ValueType> where(
+    const Field<bool>& mask,
+    const Field<ValueType>& a,
+    const std::type_identity_t<ValueType> b,
+    const std::string& name = "NeoFOAM::where"
+)
+{
+    NeoFOAM_ASSERT_EQUAL_LENGTH(mask, a);
+    Field<ValueType> result(mask.exec(), mask.size());
+    auto [spanResult, spanMask, spanA] = spans(result, mask, a);
+    parallelFor(
+        mask.exec(),
+        {0, mask.size()},
+        KOKKOS_LAMBDA(const size_t i) { spanResult[i] = spanMask[i] ? spanA[i] : b; },
+        name
+    );
+    return result;
+}
+
+/**
+ * @brief Count the set elements of a mask.
+ *
+ * @param mask The mask to count.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+inline size_t count(const Field<bool>& mask, const std::string& name = "NeoFOAM::count")
+{
+    size_t result = 0;
+    auto spanMask = mask.span();
+    parallelReduce(
+        mask.exec(),
+        {0, mask.size()},
+        KOKKOS_LAMBDA(const size_t i, size_t& acc) { acc += spanMask[i] ? 1 : 0; },
+        result,
+        name
+    );
+    return result;
+}
+
+} // namespace NeoFOAM
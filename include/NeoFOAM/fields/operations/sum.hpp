@@ -4,73 +4,60 @@
 
 #include <Kokkos_Core.hpp>
 #include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/fields/field.hpp"
 
 namespace NeoFOAM
 {
 
-struct SumKernel
-{
-    template<typename T>
-    void operator()([[maybe_unused]] const GPUExecutor& exec, const Field<T>& field, T& sum) const
-    {
-        using executor = typename GPUExecutor::exec;
-        auto field_f = field.span();
-        auto end = field.size();
-        Kokkos::parallel_reduce(
-            "sum",
-            Kokkos::RangePolicy<executor>(0, end),
-            KOKKOS_LAMBDA(const size_t i, T& lsum) { lsum += field_f[i]; },
-            sum
-        );
-    }
-
-    template<typename T>
-    void operator()([[maybe_unused]] const CPUExecutor& exec, const Field<T>& field, T& sum)
-    {
-        using executor = typename CPUExecutor::exec;
-        auto field_f = field.span();
-        auto end = field.size();
-        Kokkos::parallel_reduce(
-            "sum",
-            Kokkos::RangePolicy<executor>(0, end),
-            KOKKOS_LAMBDA(const size_t i, T& lsum) { lsum += field_f[i]; },
-            sum
-        );
-    }
-
-    template<typename T>
-    void operator()([[maybe_unused]] const SerialExecutor& exec, const Field<T>& field, T& sum)
-    {
-        using executor = typename SerialExecutor::exec;
-        auto field_f = field.span();
-        auto end = field.size();
-        Kokkos::parallel_reduce(
-            "sum",
-            Kokkos::RangePolicy<executor>(0, end),
-            KOKKOS_LAMBDA(const size_t i, T& lsum) { lsum += field_f[i]; },
-            sum
-        );
-    }
-};
-
-
+/**
+ * @brief Sum the values of a field.
+ * @param field The field to sum.
+ * @param mode The reduction mode, ReduceMode::reproducible gives the same bits on all executors.
+ */
 template<typename T>
-T sum(const Field<T>& field)
+T sum(const Field<T>& field, ReduceMode mode = reduceMode())
 {
     T sumValue {};
-    SumKernel kernel {};
-    std::visit([&](const auto& exec) { kernel(exec, field, sumValue); }, field.exec());
+    auto fieldS = field.span();
+    parallelReduce(
+        field.exec(),
+        {0, field.size()},
+        KOKKOS_LAMBDA(const size_t i, T& lsum) { lsum += fieldS[i]; },
+        sumValue,
+        mode,
+        "NeoFOAM::sum"
+    );
     return sumValue;
-};
-
-template<>
-scalar sum(const Field<scalar>& field)
+}
+
+/**
+ * @brief Sum the values of a field where a mask is set.
+ * @param field The field to sum.
+ * @param mask The mask selecting the values, it must have the size of the field.
+ * @param mode The reduction mode, ReduceMode::reproducible gives the same bits on all executors.
+ */
+template<typename T>
+T sum(const Field<T>& field, const Field<bool>& mask, ReduceMode mode = reduceMode())
 {
-    scalar sumValue = 0;
-    SumKernel kernel {};
-    std::visit([&](const auto& exec) { kernel(exec, field, sumValue); }, field.exec());
+    NeoFOAM_ASSERT_EQUAL_LENGTH(field, mask);
+    T sumValue {};
+    auto fieldS = field.span();
+    auto maskS = mask.span();
+    parallelReduce(
+        field.exec(),
+        {0, field.size()},
+        KOKKOS_LAMBDA(const size_t i, T& lsum) {
+            if (maskS[i])
+            {
+                lsum += fieldS[i];
+            }
+        },
+        sumValue,
+        mode,
+        "NeoFOAM::sum"
+    );
     return sumValue;
-};
-
+}
 
 } // namespace NeoFOAM
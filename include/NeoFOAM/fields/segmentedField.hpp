@@ -2,6 +2,10 @@
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 #pragma once
 
+#include <algorithm>
+
+#include <Kokkos_Sort.hpp>
+
 #include "NeoFOAM/core/primitives/label.hpp"
 #include "NeoFOAM/fields/field.hpp"
 
@@ -30,14 +34,15 @@ IndexType segmentsFromIntervals(const Field<IndexType>& intervals, Field<IndexTy
     NeoFOAM::parallelScan(
         intervals.exec(),
         {1, offsSpan.size()},
-        KOKKOS_LAMBDA(const std::size_t i, NeoFOAM::localIdx& update, const bool final) {
+        KOKKOS_LAMBDA(const std::size_t i, IndexType& update, const bool final) {
             update += inSpan[i - 1];
             if (final)
             {
                 offsSpan[i] = update;
             }
         },
-        finalValue
+        finalValue,
+        "NeoFOAM::segmentsFromIntervals"
     );
     return finalValue;
 }
@@ -111,6 +116,453 @@ public:
     IndexType operator[](std::size_t i) const { return segments[i]; }
 };
 
+/**
+ * @brief Compute one reduction per segment in a single kernel.
+ *
+ * For every segment [segments[segI], segments[segI + 1]) the kernel is called with each index of
+ * the segment and a thread local accumulator, which is value initialised, ie. zero for arithmetic
+ * types. The accumulated value is stored in result[segI]. Each segment is reduced by a single
+ * thread, hence this is intended for many short segments like boundary patches or cell face lists.
+ *
+ * @param exec The executor to run the reduction on.
+ * @param segments The segment offsets, must be of size result.size() + 1.
+ * @param kernel The kernel to accumulate a single entry, ie. void(const size_t i, ValueType& acc).
+ * @param result The span to store the reduced value of each segment in.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename IndexType, typename Kernel, typename ValueType>
+void segmentedReduce(
+    const Executor& exec,
+    std::span<const IndexType> segments,
+    Kernel kernel,
+    std::span<ValueType> result,
+    const std::string& name = "NeoFOAM::segmentedReduce"
+)
+{
+    if (segments.empty())
+    {
+        // no segments, nothing to reduce
+        NF_ASSERT_EQUAL(result.size(), 0);
+        return;
+    }
+    NF_ASSERT_EQUAL(segments.size(), result.size() + 1);
+    parallelFor(
+        exec,
+        {0, result.size()},
+        KOKKOS_LAMBDA(const size_t segI) {
+            ValueType acc {};
+            for (auto i = segments[segI]; i < segments[segI + 1]; i++)
+            {
+                kernel(static_cast<size_t>(i), acc);
+            }
+            result[segI] = acc;
+        },
+        name
+    );
+}
+
+/**
+ * @brief Compute one reduction per segment of a segmented field view in a single kernel.
+ *
+ * @param exec The executor to run the reduction on.
+ * @param view The segmented field view providing the segments.
+ * @param kernel The kernel to accumulate a single entry, ie. void(const size_t i, ValueType& acc).
+ * @param result The span to store the reduced value of each segment in.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType, typename IndexType, typename Kernel, typename ResultType>
+void segmentedReduce(
+    const Executor& exec,
+    const SegmentedFieldView<ValueType, IndexType>& view,
+    Kernel kernel,
+    std::span<ResultType> result,
+    const std::string& name = "NeoFOAM::segmentedReduce"
+)
+{
+    segmentedReduce(exec, std::span<const IndexType>(view.segments), kernel, result, name);
+}
+
+namespace detail
+{
+
+template<typename ExecSpace, typename IndexType, typename Kernel>
+void teamForSegments(std::span<const IndexType> segments, Kernel kernel, const std::string& name)
+{
+    using Member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+    Kokkos::parallel_for(
+        name,
+        Kokkos::TeamPolicy<ExecSpace>(segments.size() - 1, Kokkos::AUTO, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const Member& team) {
+            const size_t segI = team.league_rank();
+            Kokkos::parallel_for(
+                Kokkos::TeamVectorRange(team, segments[segI], segments[segI + 1]),
+                [&](const IndexType i) { kernel(segI, static_cast<size_t>(i)); }
+            );
+        }
+    );
+}
+
+template<typename ExecSpace, typename IndexType, typename Kernel, typename ValueType>
+void teamReduceSegments(
+    std::span<const IndexType> segments,
+    Kernel kernel,
+    std::span<ValueType> result,
+    const std::string& name
+)
+{
+    using Member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+    Kokkos::parallel_for(
+        name,
+        Kokkos::TeamPolicy<ExecSpace>(result.size(), Kokkos::AUTO, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const Member& team) {
+            const size_t segI = team.league_rank();
+            ValueType acc {};
+            Kokkos::parallel_reduce(
+                Kokkos::TeamVectorRange(team, segments[segI], segments[segI + 1]),
+                [&](const IndexType i, ValueType& lacc) { kernel(static_cast<size_t>(i), lacc); },
+                acc
+            );
+            Kokkos::single(Kokkos::PerTeam(team), [&]() { result[segI] = acc; });
+        }
+    );
+}
+
+template<typename ExecSpace, typename IndexType, typename Kernel>
+void teamForSegments(
+    std::span<const IndexType> segments, size_t innerSize, Kernel kernel, const std::string& name
+)
+{
+    using Member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+    Kokkos::parallel_for(
+        name,
+        Kokkos::TeamPolicy<ExecSpace>(segments.size() - 1, Kokkos::AUTO, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const Member& team) {
+            const size_t segI = team.league_rank();
+            Kokkos::parallel_for(
+                Kokkos::TeamThreadRange(team, segments[segI], segments[segI + 1]),
+                [&](const IndexType i)
+                {
+                    Kokkos::parallel_for(
+                        Kokkos::ThreadVectorRange(team, size_t(0), innerSize),
+                        [&](const size_t j) { kernel(segI, static_cast<size_t>(i), j); }
+                    );
+                }
+            );
+        }
+    );
+}
+
+template<typename ExecSpace, typename IndexType, typename Kernel, typename ValueType>
+void teamReduceSegments(
+    std::span<const IndexType> segments,
+    size_t innerSize,
+    Kernel kernel,
+    std::span<ValueType> result,
+    const std::string& name
+)
+{
+    using Member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+    Kokkos::parallel_for(
+        name,
+        Kokkos::TeamPolicy<ExecSpace>(result.size(), Kokkos::AUTO, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const Member& team) {
+            const size_t segI = team.league_rank();
+            ValueType acc {};
+            Kokkos::parallel_reduce(
+                Kokkos::TeamThreadRange(team, segments[segI], segments[segI + 1]),
+                [&](const IndexType i, ValueType& tacc)
+                {
+                    ValueType vacc {};
+                    Kokkos::parallel_reduce(
+                        Kokkos::ThreadVectorRange(team, size_t(0), innerSize),
+                        [&](const size_t j, ValueType& lacc)
+                        { kernel(static_cast<size_t>(i), j, lacc); },
+                        vacc
+                    );
+                    // all vector lanes hold the result of the inner reduction
+                    tacc += vacc;
+                },
+                acc
+            );
+            Kokkos::single(Kokkos::PerTeam(team), [&]() { result[segI] = acc; });
+        }
+    );
+}
+
+}
+
+/**
+ * @brief Run a kernel for every entry of every segment with one team of threads per segment.
+ *
+ * The segments are distributed over the teams and the entries of a segment over the threads and
+ * vector lanes of its team, which balances segments of different length, e.g. CSR rows or the
+ * faces of the boundary patches. On the SerialExecutor the entries are visited in nested loops.
+ *
+ * @param exec The executor to run the kernel on.
+ * @param segments The segment offsets.
+ * @param kernel The kernel for a single entry, ie. void(const size_t segI, const size_t i).
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename IndexType, typename Kernel>
+void parallelForSegments(
+    const Executor& exec,
+    std::span<const IndexType> segments,
+    Kernel kernel,
+    const std::string& name = "NeoFOAM::parallelForSegments"
+)
+{
+    if (segments.size() < 2)
+    {
+        return;
+    }
+    if (auto* recording = detail::kernelRecording())
+    {
+        recording->launches.push_back([=]() { parallelForSegments(exec, segments, kernel, name); }
+        );
+    }
+    std::visit(
+        [&](const auto& e)
+        {
+            using ExecutorType = std::decay_t<decltype(e)>;
+            if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+            {
+                for (size_t segI = 0; segI + 1 < segments.size(); segI++)
+                {
+                    for (auto i = segments[segI]; i < segments[segI + 1]; i++)
+                    {
+                        kernel(segI, static_cast<size_t>(i));
+                    }
+                }
+            }
+            else
+            {
+                detail::teamForSegments<typename ExecutorType::exec>(segments, kernel, name);
+            }
+        },
+        exec
+    );
+}
+
+/**
+ * @brief Run a kernel for every entry of every segment of a segmented field view.
+ *
+ * @param exec The executor to run the kernel on.
+ * @param view The segmented field view providing the segments.
+ * @param kernel The kernel for a single entry, ie. void(const size_t segI, const size_t i).
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType, typename IndexType, typename Kernel>
+void parallelForSegments(
+    const Executor& exec,
+    const SegmentedFieldView<ValueType, IndexType>& view,
+    Kernel kernel,
+    const std::string& name = "NeoFOAM::parallelForSegments"
+)
+{
+    parallelForSegments(exec, std::span<const IndexType>(view.segments), kernel, name);
+}
+
+/**
+ * @brief Run a kernel for every entry of every segment and every index of an inner range, using
+ * all three levels of hierarchical parallelism.
+ *
+ * The segments are distributed over the teams, the entries of a segment over the threads of its
+ * team and the inner range of an entry over the vector lanes of its thread, e.g. the components
+ * of the faces of the boundary patches or the blocks of a block CSR row. On the SerialExecutor the
+ * indices are visited in nested loops.
+ *
+ * @param exec The executor to run the kernel on.
+ * @param segments The segment offsets.
+ * @param innerSize The size of the inner range of each entry.
+ * @param kernel The kernel for a single index, ie. void(const size_t segI, const size_t i, const
+ * size_t j).
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename IndexType, typename Kernel>
+void parallelForSegments(
+    const Executor& exec,
+    std::span<const IndexType> segments,
+    size_t innerSize,
+    Kernel kernel,
+    const std::string& name = "NeoFOAM::parallelForSegments"
+)
+{
+    if (segments.size() < 2)
+    {
+        return;
+    }
+    if (auto* recording = detail::kernelRecording())
+    {
+        recording->launches.push_back(
+            [=]() { parallelForSegments(exec, segments, innerSize, kernel, name); }
+        );
+    }
+    std::visit(
+        [&](const auto& e)
+        {
+            using ExecutorType = std::decay_t<decltype(e)>;
+            if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+            {
+                for (size_t segI = 0; segI + 1 < segments.size(); segI++)
+                {
+                    for (auto i = segments[segI]; i < segments[segI + 1]; i++)
+                    {
+                        for (size_t j = 0; j < innerSize; j++)
+                        {
+                            kernel(segI, static_cast<size_t>(i), j);
+                        }
+                    }
+                }
+            }
+            else
+            {
+                detail::teamForSegments<typename ExecutorType::exec>(
+                    segments, innerSize, kernel, name
+                );
+            }
+        },
+        exec
+    );
+}
+
+/**
+ * @brief Compute one reduction per segment with one team of threads per segment.
+ *
+ * Unlike segmentedReduce, the entries of a segment are reduced by all threads and vector lanes of
+ * a team, hence this is intended for few long segments like the faces of the boundary patches.
+ *
+ * @param exec The executor to run the reduction on.
+ * @param segments The segment offsets, must be of size result.size() + 1.
+ * @param kernel The kernel to accumulate a single entry, ie. void(const size_t i, ValueType& acc).
+ * @param result The span to store the reduced value of each segment in.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename IndexType, typename Kernel, typename ValueType>
+void parallelReduceSegments(
+    const Executor& exec,
+    std::span<const IndexType> segments,
+    Kernel kernel,
+    std::span<ValueType> result,
+    const std::string& name = "NeoFOAM::parallelReduceSegments"
+)
+{
+    NF_ASSERT_EQUAL(segments.size(), result.size() + 1);
+    if (auto* recording = detail::kernelRecording())
+    {
+        recording->launches.push_back(
+            [=]() { parallelReduceSegments(exec, segments, kernel, result, name); }
+        );
+    }
+    std::visit(
+        [&](const auto& e)
+        {
+            using ExecutorType = std::decay_t<decltype(e)>;
+            if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+            {
+                for (size_t segI = 0; segI < result.size(); segI++)
+                {
+                    ValueType acc {};
+                    for (auto i = segments[segI]; i < segments[segI + 1]; i++)
+                    {
+                        kernel(static_cast<size_t>(i), acc);
+                    }
+                    result[segI] = acc;
+                }
+            }
+            else
+            {
+                detail::teamReduceSegments<typename ExecutorType::exec>(
+                    segments, kernel, result, name
+                );
+            }
+        },
+        exec
+    );
+}
+
+/**
+ * @brief Compute one reduction per segment of a segmented field view with one team per segment.
+ *
+ * @param exec The executor to run the reduction on.
+ * @param view The segmented field view providing the segments.
+ * @param kernel The kernel to accumulate a single entry, ie. void(const size_t i, ValueType& acc).
+ * @param result The span to store the reduced value of each segment in.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType, typename IndexType, typename Kernel, typename ResultType>
+void parallelReduceSegments(
+    const Executor& exec,
+    const SegmentedFieldView<ValueType, IndexType>& view,
+    Kernel kernel,
+    std::span<ResultType> result,
+    const std::string& name = "NeoFOAM::parallelReduceSegments"
+)
+{
+    parallelReduceSegments(exec, std::span<const IndexType>(view.segments), kernel, result, name);
+}
+
+/**
+ * @brief Compute one reduction per segment over the entries of the segment and an inner range of
+ * each entry, using all three levels of hierarchical parallelism.
+ *
+ * The entries of a segment are reduced by the threads of its team and the inner range of an entry
+ * by the vector lanes of its thread.
+ *
+ * @param exec The executor to run the reduction on.
+ * @param segments The segment offsets, must be of size result.size() + 1.
+ * @param innerSize The size of the inner range of each entry.
+ * @param kernel The kernel to accumulate a single index, ie. void(const size_t i, const size_t j,
+ * ValueType& acc).
+ * @param result The span to store the reduced value of each segment in.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename IndexType, typename Kernel, typename ValueType>
+void parallelReduceSegments(
+    const Executor& exec,
+    std::span<const IndexType> segments,
+    size_t innerSize,
+    Kernel kernel,
+    std::span<ValueType> result,
+    const std::string& name = "NeoFOAM::parallelReduceSegments"
+)
+{
+    NF_ASSERT_EQUAL(segments.size(), result.size() + 1);
+    if (auto* recording = detail::kernelRecording())
+    {
+        recording->launches.push_back(
+            [=]() { parallelReduceSegments(exec, segments, innerSize, kernel, result, name); }
+        );
+    }
+    std::visit(
+        [&](const auto& e)
+        {
+            using ExecutorType = std::decay_t<decltype(e)>;
+            if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+            {
+                for (size_t segI = 0; segI < result.size(); segI++)
+                {
+                    ValueType acc {};
+                    for (auto i = segments[segI]; i < segments[segI + 1]; i++)
+                    {
+                        for (size_t j = 0; j < innerSize; j++)
+                        {
+                            kernel(static_cast<size_t>(i), j, acc);
+                        }
+                    }
+                    result[segI] = acc;
+                }
+            }
+            else
+            {
+                detail::teamReduceSegments<typename ExecutorType::exec>(
+                    segments, innerSize, kernel, result, name
+                );
+            }
+        },
+        exec
+    );
+}
+
 /**
  * @class SegmentedField
  * @brief Data structure that stores a segmented fields or a vector of vectors
@@ -147,6 +599,67 @@ public:
     }
 
 
+    /**
+     * @brief Create a segmented field by grouping unsorted (key, value) pairs by their key.
+     *
+     * The pairs of each key are counted, the segments are computed by segmentsFromIntervals and
+     * the values are scattered through atomic cursors, so the order within a segment is
+     * unspecified on parallel executors unless the segments are sorted.
+     *
+     * @param keys The segment of each value, in [0, numSegments).
+     * @param values The values, of the size of the keys.
+     * @param numSegments The number of segments.
+     * @param sorted Sort the values within each segment, see sortSegments.
+     */
+    SegmentedField(
+        const Field<IndexType>& keys,
+        const Field<ValueType>& values,
+        size_t numSegments,
+        bool sorted = false
+    )
+        : values_(keys.exec(), keys.size()),
+          segments_(keys.exec(), numSegments + 1, IndexType(0))
+    {
+        NeoFOAM_ASSERT_EQUAL_LENGTH(keys, values);
+        NF_ASSERT(keys.exec() == values.exec(), "Executors are not the same.");
+        const auto& exec = keys.exec();
+        Field<IndexType> cursors(exec, numSegments, IndexType(0));
+        auto [sKeys, sValuesIn, sCursors] = NeoFOAM::spans(keys, values, cursors);
+        parallelFor(
+            exec,
+            {0, keys.size()},
+            KOKKOS_LAMBDA(const size_t i) {
+                Kokkos::atomic_add(&sCursors[static_cast<size_t>(sKeys[i])], IndexType(1));
+            },
+            "NeoFOAM::SegmentedField::count"
+        );
+        segmentsFromIntervals(cursors, segments_);
+
+        // the cursors start at the beginning of each segment
+        auto [sSegments, sValues] = NeoFOAM::spans(segments_, values_);
+        parallelFor(
+            exec,
+            {0, numSegments},
+            KOKKOS_LAMBDA(const size_t segI) { sCursors[segI] = sSegments[segI]; },
+            "NeoFOAM::SegmentedField::cursors"
+        );
+        parallelFor(
+            exec,
+            {0, keys.size()},
+            KOKKOS_LAMBDA(const size_t i) {
+                const IndexType pos = Kokkos::atomic_fetch_add(
+                    &sCursors[static_cast<size_t>(sKeys[i])], IndexType(1)
+                );
+                sValues[static_cast<size_t>(pos)] = sValuesIn[i];
+            },
+            "NeoFOAM::SegmentedField::scatter"
+        );
+        if (sorted)
+        {
+            sortSegments(*this);
+        }
+    }
+
     /**
      * @brief Constructor to create a segmentedField from values and the segments.
      * @param values The values of the segmented field.
@@ -212,4 +725,89 @@ private:
     Field<IndexType> segments_; //!< stores the [start, end) of segment i at index i, i+1
 };
 
+namespace detail
+{
+
+template<typename ExecSpace, typename ValueView, typename IndexType>
+void teamSortSegments(ValueView values, std::span<const IndexType> segments, const std::string& name)
+{
+    using Member = typename Kokkos::TeamPolicy<ExecSpace>::member_type;
+    Kokkos::parallel_for(
+        name,
+        Kokkos::TeamPolicy<ExecSpace>(segments.size() - 1, Kokkos::AUTO),
+        KOKKOS_LAMBDA(const Member& team) {
+            const size_t segI = team.league_rank();
+            auto segment = Kokkos::subview(
+                values,
+                Kokkos::make_pair(
+                    static_cast<size_t>(segments[segI]), static_cast<size_t>(segments[segI + 1])
+                )
+            );
+            Kokkos::Experimental::sort_team(team, segment);
+        }
+    );
+}
+
+}
+
+/**
+ * @brief Sort the values within each segment in ascending order.
+ *
+ * Each segment is sorted by a team of threads, on the SerialExecutor one after the other.
+ *
+ * @param exec The executor to run the sort on.
+ * @param view The segmented field view providing the values and segments.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType, typename IndexType>
+void sortSegments(
+    const Executor& exec,
+    const SegmentedFieldView<ValueType, IndexType>& view,
+    const std::string& name = "NeoFOAM::sortSegments"
+)
+{
+    detail::recordUnsupported(name);
+    if (view.segments.size() < 2)
+    {
+        return;
+    }
+    std::span<const IndexType> segments(view.segments);
+    std::visit(
+        [&](const auto& e)
+        {
+            using ExecutorType = std::decay_t<decltype(e)>;
+            if constexpr (std::is_same_v<ExecutorType, SerialExecutor>)
+            {
+                for (size_t segI = 0; segI + 1 < segments.size(); segI++)
+                {
+                    std::sort(
+                        view.values.data() + segments[segI], view.values.data() + segments[segI + 1]
+                    );
+                }
+            }
+            else
+            {
+                detail::teamSortSegments<typename ExecutorType::exec>(
+                    e.createKokkosView(view.values.data(), view.values.size()), segments, name
+                );
+            }
+        },
+        exec
+    );
+}
+
+/**
+ * @brief Sort the values within each segment of a segmented field in ascending order.
+ *
+ * @param field The segmented field to sort.
+ * @param name The kernel name reported to Kokkos Tools.
+ */
+template<typename ValueType, typename IndexType>
+void sortSegments(
+    SegmentedField<ValueType, IndexType>& field, const std::string& name = "NeoFOAM::sortSegments"
+)
+{
+    sortSegments(field.exec(), field.view(), name);
+}
+
 } // namespace NeoFOAM
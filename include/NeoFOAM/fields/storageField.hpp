@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+#pragma once
+
+#include <optional>
+#include <span>
+#include <variant>
+
+#include "NeoFOAM/fields/field.hpp"
+
+namespace NeoFOAM
+{
+
+/**
+ * @brief The precision values are stored in, the kernels always compute in full precision.
+ */
+enum class Precision
+{
+    full,   ///< Store the values in their own type.
+    reduced ///< Store the values in the reduced type, e.g. float for double.
+};
+
+/**
+ * @brief The type used to store values of ValueType in reduced precision.
+ */
+template<typename ValueType>
+struct ReducedPrecision
+{
+    using type = ValueType;
+};
+
+template<>
+struct ReducedPrecision<double>
+{
+    using type = float;
+};
+
+template<typename ValueType>
+using ReducedType = typename ReducedPrecision<ValueType>::type;
+
+/**
+ * @class WideningSpan
+ * @brief A read only view of values stored as StorageType, which are widened to ValueType on
+ * access.
+ *
+ * The widening happens in registers, so a kernel reading a span of floats loads half the bytes
+ * of a span of doubles while computing in double precision.
+ */
+template<typename ValueType, typename StorageType>
+class WideningSpan
+{
+public:
+
+    WideningSpan(std::span<const StorageType> data) : data_(data) {}
+
+    KOKKOS_INLINE_FUNCTION
+    ValueType operator[](size_t i) const { return static_cast<ValueType>(data_[i]); }
+
+    KOKKOS_INLINE_FUNCTION
+    size_t size() const { return data_.size(); }
+
+private:
+
+    std::span<const StorageType> data_;
+};
+
+/**
+ * @brief Convert a field to another value type.
+ * @param src The field to convert.
+ * @return The converted field on the executor of src.
+ */
+template<typename DstType, typename SrcType>
+Field<DstType> convert(const Field<SrcType>& src)
+{
+    Field<DstType> dst(src.exec(), src.size());
+    auto srcSpan = src.span();
+    parallelFor(
+        dst, KOKKOS_LAMBDA(const size_t i) { return static_cast<DstType>(srcSpan[i]); },
+        "NeoFOAM::convert"
+    );
+    return dst;
+}
+
+/**
+ * @brief Call a function with a widening span of the reduced copy if present, otherwise of the
+ * field itself.
+ *
+ * This is used for read only arrays, e.g. of the mesh geometry, which keep their full precision
+ * values and optionally provide a reduced copy to bandwidth bound kernels.
+ * @param field The values in full precision.
+ * @param reduced The values in reduced precision, if selected.
+ * @param f The function called with a WideningSpan.
+ */
+template<typename ValueType, typename Func>
+decltype(auto) visitWidened(
+    const Field<ValueType>& field,
+    const std::optional<Field<ReducedType<ValueType>>>& reduced,
+    Func f
+)
+{
+    if (reduced)
+    {
+        return f(WideningSpan<ValueType, ReducedType<ValueType>>(reduced->span()));
+    }
+    return f(WideningSpan<ValueType, ValueType>(field.span()));
+}
+
+/**
+ * @class StorageField
+ * @brief A field storing its values in full or reduced precision, selectable at runtime.
+ *
+ * Kernels access the values through visit, which instantiates them for both storage types:
+ * @code
+ * StorageField<scalar> weights(w, Precision::reduced);
+ * weights.visit([&](auto wSpan) { interpolate(exec, wSpan, phi, phif); });
+ * @endcode
+ * The function passed to visit should not contain a KOKKOS_LAMBDA itself, since device lambdas
+ * can not be defined in generic lambdas, but call a function template which does.
+ *
+ * @ingroup Fields
+ */
+template<typename ValueType>
+class StorageField
+{
+public:
+
+    /**
+     * @brief Create a StorageField from the values of a field.
+     * @param field The values to store.
+     * @param precision The precision to store the values in.
+     */
+    StorageField(const Field<ValueType>& field, Precision precision = Precision::full)
+        : data_(std::in_place_index<0>, field)
+    {
+        setPrecision(precision);
+    }
+
+    /**
+     * @brief Get the precision the values are stored in.
+     */
+    Precision precision() const { return data_.index() == 0 ? Precision::full : Precision::reduced; }
+
+    /**
+     * @brief Get the executor of the values.
+     */
+    const Executor& exec() const
+    {
+        return std::visit([](const auto& field) -> const Executor& { return field.exec(); }, data_);
+    }
+
+    /**
+     * @brief Get the number of values.
+     */
+    size_t size() const
+    {
+        return std::visit([](const auto& field) { return field.size(); }, data_);
+    }
+
+    /**
+     * @brief Get the size of the stored values in bytes.
+     */
+    size_t bytes() const
+    {
+        return size()
+             * (data_.index() == 0 ? sizeof(ValueType) : sizeof(ReducedType<ValueType>));
+    }
+
+    /**
+     * @brief Convert the stored values to the given precision.
+     */
+    void setPrecision(Precision precision)
+    {
+        if (precision == this->precision())
+        {
+            return;
+        }
+        if (precision == Precision::reduced)
+        {
+            data_.template emplace<1>(convert<ReducedType<ValueType>>(std::get<0>(data_)));
+        }
+        else
+        {
+            data_.template emplace<0>(convert<ValueType>(std::get<1>(data_)));
+        }
+    }
+
+    /**
+     * @brief Store the values of a field in the current precision.
+     * @param field The values to store.
+     */
+    void assign(const Field<ValueType>& field)
+    {
+        if (precision() == Precision::reduced)
+        {
+            data_.template emplace<1>(convert<ReducedType<ValueType>>(field));
+        }
+        else
+        {
+            data_.template emplace<0>(field);
+        }
+    }
+
+    /**
+     * @brief Get the values in full precision.
+     */
+    Field<ValueType> widen() const
+    {
+        if (precision() == Precision::reduced)
+        {
+            return convert<ValueType>(std::get<1>(data_));
+        }
+        return std::get<0>(data_);
+    }
+
+    /**
+     * @brief Call a function with a WideningSpan of the stored values.
+     * @param f The function, it has to accept the spans of both storage types.
+     */
+    template<typename Func>
+    decltype(auto) visit(Func f) const
+    {
+        if (precision() == Precision::reduced)
+        {
+            return f(WideningSpan<ValueType, ReducedType<ValueType>>(std::get<1>(data_).span()));
+        }
+        return f(WideningSpan<ValueType, ValueType>(std::get<0>(data_).span()));
+    }
+
+private:
+
+    std::variant<Field<ValueType>, Field<ReducedType<ValueType>>> data_;
+};
+
+} // namespace NeoFOAM
@@ -41,31 +41,41 @@ namespace NeoFOAM
 
 namespace fvcc = finiteVolume::cellCentred;
 
-template class fvcc::VolumeBoundaryFactory<scalar>;
-template class fvcc::VolumeBoundaryFactory<Vector>;
-
-template class fvcc::volumeBoundary::FixedValue<scalar>;
-template class fvcc::volumeBoundary::FixedValue<Vector>;
-
-template class fvcc::volumeBoundary::FixedGradient<scalar>;
-template class fvcc::volumeBoundary::FixedGradient<Vector>;
-
-template class fvcc::volumeBoundary::Calculated<scalar>;
-template class fvcc::volumeBoundary::Calculated<Vector>;
-
-template class fvcc::volumeBoundary::Empty<scalar>;
-template class fvcc::volumeBoundary::Empty<Vector>;
-
-template class fvcc::SurfaceBoundaryFactory<scalar>;
-template class fvcc::SurfaceBoundaryFactory<Vector>;
-
-template class fvcc::surfaceBoundary::FixedValue<scalar>;
-template class fvcc::surfaceBoundary::FixedValue<Vector>;
-
-template class fvcc::surfaceBoundary::Calculated<scalar>;
-template class fvcc::surfaceBoundary::Calculated<Vector>;
-
-template class fvcc::surfaceBoundary::Empty<scalar>;
-template class fvcc::surfaceBoundary::Empty<Vector>;
+// instantiated in boundary.cpp for both precisions, independent of the precision selected for scalar
+extern template class fvcc::VolumeBoundaryFactory<float>;
+extern template class fvcc::VolumeBoundaryFactory<double>;
+extern template class fvcc::VolumeBoundaryFactory<Vector>;
+
+extern template class fvcc::volumeBoundary::FixedValue<float>;
+extern template class fvcc::volumeBoundary::FixedValue<double>;
+extern template class fvcc::volumeBoundary::FixedValue<Vector>;
+
+extern template class fvcc::volumeBoundary::FixedGradient<float>;
+extern template class fvcc::volumeBoundary::FixedGradient<double>;
+extern template class fvcc::volumeBoundary::FixedGradient<Vector>;
+
+extern template class fvcc::volumeBoundary::Calculated<float>;
+extern template class fvcc::volumeBoundary::Calculated<double>;
+extern template class fvcc::volumeBoundary::Calculated<Vector>;
+
+extern template class fvcc::volumeBoundary::Empty<float>;
+extern template class fvcc::volumeBoundary::Empty<double>;
+extern template class fvcc::volumeBoundary::Empty<Vector>;
+
+extern template class fvcc::SurfaceBoundaryFactory<float>;
+extern template class fvcc::SurfaceBoundaryFactory<double>;
+extern template class fvcc::SurfaceBoundaryFactory<Vector>;
+
+extern template class fvcc::surfaceBoundary::FixedValue<float>;
+extern template class fvcc::surfaceBoundary::FixedValue<double>;
+extern template class fvcc::surfaceBoundary::FixedValue<Vector>;
+
+extern template class fvcc::surfaceBoundary::Calculated<float>;
+extern template class fvcc::surfaceBoundary::Calculated<double>;
+extern template class fvcc::surfaceBoundary::Calculated<Vector>;
+
+extern template class fvcc::surfaceBoundary::Empty<float>;
+extern template class fvcc::surfaceBoundary::Empty<double>;
+extern template class fvcc::surfaceBoundary::Empty<Vector>;
 
 }
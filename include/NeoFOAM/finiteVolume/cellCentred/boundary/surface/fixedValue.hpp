@@ -36,7 +36,8 @@ void setFixedValue(
             refValue[i] = fixedValue;
             value[i] = fixedValue;
             internalValues[nInternalFaces + i] = fixedValue;
-        }
+        },
+        "surfaceBoundary::fixedValue"
     );
 }
 }
@@ -30,6 +30,8 @@ void setGradientValue(
     auto value = domainField.boundaryField().value().span();
     auto faceCells = mesh.boundaryMesh().faceCells(static_cast<localIdx>(patchID));
     auto deltaCoeffs = mesh.boundaryMesh().deltaCoeffs(static_cast<localIdx>(patchID));
+    // faceCells and deltaCoeffs only span the patch, refGradient and value all boundary faces
+    const size_t start = range.first;
 
     NeoFOAM::parallelFor(
         domainField.exec(),
@@ -37,9 +39,19 @@ void setGradientValue(
         KOKKOS_LAMBDA(const size_t i) {
             refGradient[i] = fixedGradient;
             // operator / is not defined for all ValueTypes
-            value[i] =
-                iField[static_cast<size_t>(faceCells[i])] + fixedGradient * (1 / deltaCoeffs[i]);
-        }
+            const scalar delta = 1 / deltaCoeffs[i - start];
+            const size_t celli = static_cast<size_t>(faceCells[i - start]);
+            if constexpr (std::is_same_v<ValueType, float>)
+            {
+                // the mesh is stored in scalar precision
+                value[i] = iField[celli] + fixedGradient * static_cast<float>(delta);
+            }
+            else
+            {
+                value[i] = iField[celli] + fixedGradient * delta;
+            }
+        },
+        "volumeBoundary::fixedGradient"
     );
 }
 }
@@ -31,7 +31,8 @@ void setFixedValue(
         KOKKOS_LAMBDA(const size_t i) {
             refValue[i] = fixedValue;
             value[i] = fixedValue;
-        }
+        },
+        "volumeBoundary::fixedValue"
     );
 }
 
@@ -5,6 +5,7 @@
 
 #include <vector>
 
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/fields/geometricField.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/boundary/surfaceBoundaryFactory.hpp"
 
@@ -46,10 +47,7 @@ public:
             fieldName,
             mesh,
             DomainField<ValueType>(
-                exec,
-                mesh.nInternalFaces() + mesh.nBoundaryFaces(),
-                mesh.nBoundaryFaces(),
-                mesh.nBoundaries()
+                exec, mesh.nInternalFaces() + mesh.nBoundaryFaces(), mesh.boundaryMesh().offset()
             )
         ),
           boundaryConditions_(boundaryConditions)
@@ -107,6 +105,8 @@ public:
      */
     void correctBoundaryConditions()
     {
+        Kokkos::Profiling::ScopedRegion region("NeoFOAM::SurfaceField::correctBoundaryConditions");
+        NF_PROFILE_SCOPE("correctBoundaryConditions");
         for (auto& boundaryCondition : boundaryConditions_)
         {
             boundaryCondition.correctBoundaryCondition(this->field_);
@@ -5,6 +5,7 @@
 
 #include <vector>
 
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/core/database/database.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/fields/geometricField.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/boundary/volumeBoundaryFactory.hpp"
@@ -49,7 +50,7 @@ public:
             exec,
             name,
             mesh,
-            DomainField<ValueType>(exec, mesh.nCells(), mesh.nBoundaryFaces(), mesh.nBoundaries())
+            DomainField<ValueType>(exec, mesh.nCells(), mesh.boundaryMesh().offset())
         ),
           key(""), fieldCollectionName(""), boundaryConditions_(boundaryConditions),
           db_(std::nullopt)
@@ -76,7 +77,7 @@ public:
             exec,
             name,
             mesh,
-            DomainField<ValueType>(exec, internalField, mesh.nBoundaryFaces(), mesh.nBoundaries())
+            DomainField<ValueType>(exec, internalField, mesh.boundaryMesh().offset())
         ),
           key(""), fieldCollectionName(""), boundaryConditions_(boundaryConditions),
           db_(std::nullopt)
@@ -129,7 +130,7 @@ public:
             exec,
             fieldName,
             mesh,
-            DomainField<ValueType>(exec, internalField, mesh.nBoundaryFaces(), mesh.nBoundaries())
+            DomainField<ValueType>(exec, internalField, mesh.boundaryMesh().offset())
         ),
           key(dbKey), fieldCollectionName(collectionName), boundaryConditions_(boundaryConditions),
           db_(&db)
@@ -149,6 +150,8 @@ public:
      */
     void correctBoundaryConditions()
     {
+        Kokkos::Profiling::ScopedRegion region("NeoFOAM::VolumeField::correctBoundaryConditions");
+        NF_PROFILE_SCOPE("correctBoundaryConditions");
         for (auto& boundaryCondition : boundaryConditions_)
         {
             boundaryCondition.correctBoundaryCondition(this->field_);
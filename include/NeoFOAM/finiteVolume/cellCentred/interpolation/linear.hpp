@@ -18,8 +18,11 @@ namespace NeoFOAM::finiteVolume::cellCentred
 {
 
 
-class Linear : public SurfaceInterpolationFactory::Register<Linear>
+template<typename ValueType>
+class Linear :
+    public SurfaceInterpolationFactory<ValueType>::template Register<Linear<ValueType>>
 {
+    using Base = SurfaceInterpolationFactory<ValueType>::template Register<Linear<ValueType>>;
 
 public:
 
@@ -33,20 +36,25 @@ public:
 
     static std::string schema() { return "none"; }
 
-    void interpolate(const VolumeField<scalar>& volField, SurfaceField<scalar>& surfaceField)
-        const override;
+    void interpolate(
+        const VolumeField<ValueType>& volField, SurfaceField<ValueType>& surfaceField
+    ) const override;
 
     void interpolate(
         const SurfaceField<scalar>& faceFlux,
-        const VolumeField<scalar>& volField,
-        SurfaceField<scalar>& surfaceField
+        const VolumeField<ValueType>& volField,
+        SurfaceField<ValueType>& surfaceField
     ) const override;
 
-    std::unique_ptr<SurfaceInterpolationFactory> clone() const override;
+    std::unique_ptr<SurfaceInterpolationFactory<ValueType>> clone() const override;
 
 private:
 
     const std::shared_ptr<GeometryScheme> geometryScheme_;
 };
 
+// instantiated in linear.cpp for both precisions
+extern template class Linear<float>;
+extern template class Linear<double>;
+
 } // namespace NeoFOAM
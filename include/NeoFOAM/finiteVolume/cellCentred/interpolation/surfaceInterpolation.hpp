@@ -18,12 +18,18 @@
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
+/* @class Factory class to create surface interpolation schemes by a given name using NeoFOAMs
+ * runTimeFactory mechanism
+ *
+ * @tparam ValueType The value type of the interpolated fields, the face fluxes are always given in
+ * scalar precision
+ */
+template<typename ValueType>
 class SurfaceInterpolationFactory :
     public NeoFOAM::RuntimeSelectionFactory<
-        SurfaceInterpolationFactory,
+        SurfaceInterpolationFactory<ValueType>,
         Parameters<const Executor&, const UnstructuredMesh&, Input>>
 {
-    using ScalarSurfaceField = SurfaceField<scalar>;
 
 public:
 
@@ -36,8 +42,8 @@ public:
                 ? std::get<NeoFOAM::Dictionary>(inputs).get<std::string>("surfaceInterpolation")
                 : std::get<NeoFOAM::TokenList>(inputs).get<std::string>(0);
 
-        keyExistsOrError(key);
-        return table().at(key)(exec, uMesh, inputs);
+        SurfaceInterpolationFactory::keyExistsOrError(key);
+        return SurfaceInterpolationFactory::table().at(key)(exec, uMesh, inputs);
     }
 
     static std::string name() { return "SurfaceInterpolationFactory"; }
@@ -47,13 +53,14 @@ public:
 
     virtual ~SurfaceInterpolationFactory() {} // Virtual destructor
 
-    virtual void
-    interpolate(const VolumeField<scalar>& volField, ScalarSurfaceField& surfaceField) const = 0;
+    virtual void interpolate(
+        const VolumeField<ValueType>& volField, SurfaceField<ValueType>& surfaceField
+    ) const = 0;
 
     virtual void interpolate(
-        const ScalarSurfaceField& faceFlux,
-        const VolumeField<scalar>& volField,
-        ScalarSurfaceField& surfaceField
+        const SurfaceField<scalar>& faceFlux,
+        const VolumeField<ValueType>& volField,
+        SurfaceField<ValueType>& surfaceField
     ) const = 0;
 
     // Pure virtual function for cloning
@@ -65,9 +72,9 @@ protected:
     const UnstructuredMesh& mesh_;
 };
 
+template<typename ValueType>
 class SurfaceInterpolation
 {
-    using ScalarSurfaceField = SurfaceField<scalar>;
 
 public:
 
@@ -82,45 +89,47 @@ public:
     SurfaceInterpolation(
         const Executor& exec,
         const UnstructuredMesh& mesh,
-        std::unique_ptr<SurfaceInterpolationFactory> interpolationKernel
+        std::unique_ptr<SurfaceInterpolationFactory<ValueType>> interpolationKernel
     )
         : exec_(exec), mesh_(mesh), interpolationKernel_(std::move(interpolationKernel)) {};
 
     SurfaceInterpolation(const Executor& exec, const UnstructuredMesh& mesh, Input input)
         : exec_(exec), mesh_(mesh),
-          interpolationKernel_(SurfaceInterpolationFactory::create(exec, mesh, input)) {};
+          interpolationKernel_(SurfaceInterpolationFactory<ValueType>::create(exec, mesh, input)
+          ) {};
 
 
-    void interpolate(const VolumeField<scalar>& volField, ScalarSurfaceField& surfaceField) const
+    void interpolate(const VolumeField<ValueType>& volField, SurfaceField<ValueType>& surfaceField)
+        const
     {
         interpolationKernel_->interpolate(volField, surfaceField);
     }
 
-    ScalarSurfaceField interpolate(const VolumeField<scalar>& volField) const
+    SurfaceField<ValueType> interpolate(const VolumeField<ValueType>& volField) const
     {
         std::string nameInterpolated = "interpolated_" + volField.name;
-        ScalarSurfaceField surfaceField(
-            exec_, nameInterpolated, mesh_, createCalculatedBCs<SurfaceBoundary<scalar>>(mesh_)
+        SurfaceField<ValueType> surfaceField(
+            exec_, nameInterpolated, mesh_, createCalculatedBCs<SurfaceBoundary<ValueType>>(mesh_)
         );
-        interpolate(surfaceField, volField);
+        interpolate(volField, surfaceField);
         return surfaceField;
     }
 
     void interpolate(
-        const ScalarSurfaceField& faceFlux,
-        const VolumeField<scalar>& volField,
-        ScalarSurfaceField& surfaceField
+        const SurfaceField<scalar>& faceFlux,
+        const VolumeField<ValueType>& volField,
+        SurfaceField<ValueType>& surfaceField
     ) const
     {
         interpolationKernel_->interpolate(faceFlux, volField, surfaceField);
     }
 
-    ScalarSurfaceField
-    interpolate(const ScalarSurfaceField& faceFlux, const VolumeField<scalar>& volField) const
+    SurfaceField<ValueType>
+    interpolate(const SurfaceField<scalar>& faceFlux, const VolumeField<ValueType>& volField) const
     {
         std::string name = "interpolated_" + volField.name;
-        ScalarSurfaceField surfaceField(
-            exec_, name, mesh_, createCalculatedBCs<SurfaceBoundary<scalar>>(mesh_)
+        SurfaceField<ValueType> surfaceField(
+            exec_, name, mesh_, createCalculatedBCs<SurfaceBoundary<ValueType>>(mesh_)
         );
         interpolate(faceFlux, volField, surfaceField);
         return surfaceField;
@@ -130,7 +139,7 @@ private:
 
     const Executor exec_;
     const UnstructuredMesh& mesh_;
-    std::unique_ptr<SurfaceInterpolationFactory> interpolationKernel_;
+    std::unique_ptr<SurfaceInterpolationFactory<ValueType>> interpolationKernel_;
 };
 
 
@@ -16,8 +16,11 @@
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
-class Upwind : public SurfaceInterpolationFactory::Register<Upwind>
+template<typename ValueType>
+class Upwind :
+    public SurfaceInterpolationFactory<ValueType>::template Register<Upwind<ValueType>>
 {
+    using Base = SurfaceInterpolationFactory<ValueType>::template Register<Upwind<ValueType>>;
 
 public:
 
@@ -29,20 +32,25 @@ public:
 
     static std::string schema() { return "none"; }
 
-    void interpolate(const VolumeField<scalar>& volField, SurfaceField<scalar>& surfaceField)
-        const override;
+    void interpolate(
+        const VolumeField<ValueType>& volField, SurfaceField<ValueType>& surfaceField
+    ) const override;
 
     void interpolate(
         const SurfaceField<scalar>& faceFlux,
-        const VolumeField<scalar>& volField,
-        SurfaceField<scalar>& surfaceField
+        const VolumeField<ValueType>& volField,
+        SurfaceField<ValueType>& surfaceField
     ) const override;
 
-    std::unique_ptr<SurfaceInterpolationFactory> clone() const override;
+    std::unique_ptr<SurfaceInterpolationFactory<ValueType>> clone() const override;
 
 private:
 
     const std::shared_ptr<GeometryScheme> geometryScheme_;
 };
 
+// instantiated in upwind.cpp for both precisions
+extern template class Upwind<float>;
+extern template class Upwind<double>;
+
 } // namespace NeoFOAM
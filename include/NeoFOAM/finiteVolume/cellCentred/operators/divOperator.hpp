@@ -15,10 +15,14 @@ namespace NeoFOAM::finiteVolume::cellCentred
 
 /* @class Factory class to create divergence operators by a given name using
  * using NeoFOAMs runTimeFactory mechanism
+ *
+ * @tparam ValueType The value type of the field, the face fluxes are always given in scalar
+ * precision
  */
+template<typename ValueType>
 class DivOperatorFactory :
     public RuntimeSelectionFactory<
-        DivOperatorFactory,
+        DivOperatorFactory<ValueType>,
         Parameters<const Executor&, const UnstructuredMesh&, const Input&>>
 {
 
@@ -30,8 +34,8 @@ public:
         std::string key = (std::holds_alternative<Dictionary>(inputs))
                             ? std::get<Dictionary>(inputs).get<std::string>("DivOperator")
                             : std::get<TokenList>(inputs).popFront<std::string>();
-        keyExistsOrError(key);
-        return table().at(key)(exec, uMesh, inputs);
+        DivOperatorFactory::keyExistsOrError(key);
+        return DivOperatorFactory::table().at(key)(exec, uMesh, inputs);
     }
 
     static std::string name() { return "DivOperatorFactory"; }
@@ -41,15 +45,18 @@ public:
 
     virtual ~DivOperatorFactory() {} // Virtual destructor
 
-    virtual void
-    div(VolumeField<scalar>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi
+    virtual void div(
+        VolumeField<ValueType>& divPhi,
+        const SurfaceField<scalar>& faceFlux,
+        VolumeField<ValueType>& phi
     ) = 0;
 
-    virtual void
-    div(Field<scalar>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi) = 0;
+    virtual void div(
+        Field<ValueType>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<ValueType>& phi
+    ) = 0;
 
-    virtual VolumeField<scalar>
-    div(const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi) = 0;
+    virtual VolumeField<ValueType>
+    div(const SurfaceField<scalar>& faceFlux, VolumeField<ValueType>& phi) = 0;
 
     // Pure virtual function for cloning
     virtual std::unique_ptr<DivOperatorFactory> clone() const = 0;
@@ -61,77 +68,86 @@ protected:
     const UnstructuredMesh& mesh_;
 };
 
-class DivOperator : public dsl::OperatorMixin<VolumeField<scalar>>
+template<typename ValueType>
+class DivOperator : public dsl::OperatorMixin<VolumeField<ValueType>>
 {
 
 public:
 
+    using Base = dsl::OperatorMixin<VolumeField<ValueType>>;
+
     // copy constructor
     DivOperator(const DivOperator& divOp)
-        : dsl::OperatorMixin<VolumeField<scalar>>(divOp.exec_, divOp.field_, divOp.type_),
-          faceFlux_(divOp.faceFlux_),
+        : Base(divOp.exec_, divOp.field_, divOp.type_), faceFlux_(divOp.faceFlux_),
           divOperatorStrategy_(
               divOp.divOperatorStrategy_ ? divOp.divOperatorStrategy_->clone() : nullptr
           ) {};
 
     DivOperator(
-        dsl::Operator::Type termType,
+        dsl::OperatorType termType,
         const SurfaceField<scalar>& faceFlux,
-        VolumeField<scalar>& phi,
+        VolumeField<ValueType>& phi,
         Input input
     )
-        : dsl::OperatorMixin<VolumeField<scalar>>(phi.exec(), phi, termType), faceFlux_(faceFlux),
-          divOperatorStrategy_(DivOperatorFactory::create(exec_, phi.mesh(), input)) {};
+        : Base(phi.exec(), phi, termType), faceFlux_(faceFlux),
+          divOperatorStrategy_(DivOperatorFactory<ValueType>::create(phi.exec(), phi.mesh(), input)
+          ) {};
 
     DivOperator(
-        dsl::Operator::Type termType,
+        dsl::OperatorType termType,
         const SurfaceField<scalar>& faceFlux,
-        VolumeField<scalar>& phi,
-        std::unique_ptr<DivOperatorFactory> divOperatorStrategy
+        VolumeField<ValueType>& phi,
+        std::unique_ptr<DivOperatorFactory<ValueType>> divOperatorStrategy
     )
-        : dsl::OperatorMixin<VolumeField<scalar>>(phi.exec(), phi, termType), faceFlux_(faceFlux),
+        : Base(phi.exec(), phi, termType), faceFlux_(faceFlux),
           divOperatorStrategy_(std::move(divOperatorStrategy)) {};
 
     DivOperator(
-        dsl::Operator::Type termType, const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi
+        dsl::OperatorType termType,
+        const SurfaceField<scalar>& faceFlux,
+        VolumeField<ValueType>& phi
     )
-        : dsl::OperatorMixin<VolumeField<scalar>>(phi.exec(), phi, termType), faceFlux_(faceFlux),
-          divOperatorStrategy_(nullptr) {};
+        : Base(phi.exec(), phi, termType), faceFlux_(faceFlux), divOperatorStrategy_(nullptr) {};
 
 
-    void explicitOperation(Field<scalar>& source)
+    void explicitOperation(Field<ValueType>& source)
     {
         if (divOperatorStrategy_ == nullptr)
         {
             NF_ERROR_EXIT("DivOperatorStrategy not initialized");
         }
-        NeoFOAM::Field<NeoFOAM::scalar> tmpsource(source.exec(), source.size(), 0.0);
-        divOperatorStrategy_->div(tmpsource, faceFlux_, field_);
+        NeoFOAM::Field<ValueType> tmpsource(source.exec(), source.size(), ValueType(0));
+        divOperatorStrategy_->div(tmpsource, faceFlux_, this->field_);
         source += tmpsource;
     }
 
-    void div(Field<scalar>& divPhi) { divOperatorStrategy_->div(divPhi, faceFlux_, getField()); }
+    void div(Field<ValueType>& divPhi)
+    {
+        divOperatorStrategy_->div(divPhi, faceFlux_, this->getField());
+    }
 
-    void div(VolumeField<scalar>& divPhi)
+    void div(VolumeField<ValueType>& divPhi)
     {
-        divOperatorStrategy_->div(divPhi, faceFlux_, getField());
+        divOperatorStrategy_->div(divPhi, faceFlux_, this->getField());
     }
 
 
     void build(const Input& input)
     {
-        const UnstructuredMesh& mesh = field_.mesh();
+        const UnstructuredMesh& mesh = this->field_.mesh();
         if (std::holds_alternative<NeoFOAM::Dictionary>(input))
         {
             auto dict = std::get<NeoFOAM::Dictionary>(input);
-            std::string schemeName = "div(" + faceFlux_.name + "," + field_.name + ")";
+            std::string schemeName = "div(" + faceFlux_.name + "," + this->field_.name + ")";
             auto tokens = dict.subDict("divSchemes").get<NeoFOAM::TokenList>(schemeName);
-            divOperatorStrategy_ = DivOperatorFactory::create(exec(), mesh, tokens);
+            divOperatorStrategy_ =
+                DivOperatorFactory<ValueType>::create(this->exec(), mesh, tokens);
         }
         else
         {
             auto tokens = std::get<NeoFOAM::TokenList>(input);
-            divOperatorStrategy_ = DivOperatorFactory::create(exec(), mesh, tokens);
+            divOperatorStrategy_ =
+                DivOperatorFactory<ValueType>::create(this->exec(), mesh, tokens);
         }
     }
 
@@ -141,7 +157,7 @@ private:
 
     const SurfaceField<NeoFOAM::scalar>& faceFlux_;
 
-    std::unique_ptr<DivOperatorFactory> divOperatorStrategy_;
+    std::unique_ptr<DivOperatorFactory<ValueType>> divOperatorStrategy_;
 };
 
 
@@ -12,8 +12,12 @@
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
-class GaussGreenDiv : public DivOperatorFactory::Register<GaussGreenDiv>
+template<typename ValueType>
+class GaussGreenDiv :
+    public DivOperatorFactory<ValueType>::template Register<GaussGreenDiv<ValueType>>
 {
+    using Base = DivOperatorFactory<ValueType>::template Register<GaussGreenDiv<ValueType>>;
+
 public:
 
     static std::string name() { return "Gauss"; }
@@ -24,22 +28,28 @@ public:
 
     GaussGreenDiv(const Executor& exec, const UnstructuredMesh& mesh, const Input& inputs);
 
-    void
-    div(VolumeField<scalar>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi
+    void div(
+        VolumeField<ValueType>& divPhi,
+        const SurfaceField<scalar>& faceFlux,
+        VolumeField<ValueType>& phi
     ) override;
 
-    void
-    div(Field<scalar>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi
+    void div(
+        Field<ValueType>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<ValueType>& phi
     ) override;
 
-    VolumeField<scalar>
-    div(const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi) override;
+    VolumeField<ValueType>
+    div(const SurfaceField<scalar>& faceFlux, VolumeField<ValueType>& phi) override;
 
-    std::unique_ptr<DivOperatorFactory> clone() const override;
+    std::unique_ptr<DivOperatorFactory<ValueType>> clone() const override;
 
 private:
 
-    SurfaceInterpolation surfaceInterpolation_;
+    SurfaceInterpolation<ValueType> surfaceInterpolation_;
 };
 
+// instantiated in gaussGreenDiv.cpp for both precisions
+extern template class GaussGreenDiv<float>;
+extern template class GaussGreenDiv<double>;
+
 } // namespace NeoFOAM
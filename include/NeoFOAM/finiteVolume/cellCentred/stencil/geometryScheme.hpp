@@ -2,10 +2,12 @@
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 #pragma once
 
+#include <optional>
 
 #include "NeoFOAM/core/primitives/vector.hpp"
 #include "NeoFOAM/core/primitives/scalar.hpp"
 #include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/fields/storageField.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/fields/surfaceField.hpp"
 #include "NeoFOAM/mesh/unstructured.hpp"
 
@@ -69,6 +71,28 @@ public:
 
     void update();
 
+    /**
+     * @brief Select the precision the interpolation kernels read the weights in.
+     *
+     * Reduced precision keeps a copy of the internal weights in the reduced type, which is
+     * refreshed by update.
+     */
+    void setWeightsPrecision(Precision precision);
+
+    Precision weightsPrecision() const;
+
+    /**
+     * @brief Call a function with a WideningSpan of the internal weights in the selected
+     * precision.
+     *
+     * @param f The function, it has to accept the spans of both precisions.
+     */
+    template<typename Func>
+    decltype(auto) visitWeights(Func f) const
+    {
+        return visitWidened(weights_.internalField(), reducedWeights_, f);
+    }
+
     std::string name() const;
 
     // add selection mechanism via dictionary later
@@ -81,6 +105,7 @@ private:
     std::unique_ptr<GeometrySchemeFactory> kernel_;
 
     SurfaceField<scalar> weights_;
+    std::optional<Field<ReducedType<scalar>>> reducedWeights_;
     SurfaceField<scalar> deltaCoeffs_;
     SurfaceField<scalar> nonOrthDeltaCoeffs_;
     SurfaceField<Vector> nonOrthCorrectionVectors_;
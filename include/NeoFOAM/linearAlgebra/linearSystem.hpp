@@ -2,7 +2,9 @@
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 #pragma once
 
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
 #include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/fields/storageField.hpp"
 #include "NeoFOAM/linearAlgebra/CSRMatrix.hpp"
 
 
@@ -45,4 +47,28 @@ private:
     Field<ValueType> rhs_;
 };
 
+/**
+ * @brief Convert a linear system to another value type, e.g. to assemble it in double precision
+ * and solve or precondition it in single precision.
+ * @param ls The linear system to convert.
+ * @return The converted linear system on the executor of ls.
+ */
+template<typename DstType, typename ValueType, typename IndexType>
+LinearSystem<DstType, IndexType> convert(const LinearSystem<ValueType, IndexType>& ls)
+{
+    const auto& exec = ls.exec();
+    const auto& matrix = ls.matrix();
+    const auto srcValues = matrix.values();
+    Field<DstType> values(exec, srcValues.size());
+    parallelFor(
+        values, KOKKOS_LAMBDA(const size_t i) { return static_cast<DstType>(srcValues[i]); },
+        "la::convert"
+    );
+    Field<IndexType> colIdxs(exec, matrix.colIdxs().data(), matrix.colIdxs().size(), exec);
+    Field<IndexType> rowPtrs(exec, matrix.rowPtrs().data(), matrix.rowPtrs().size(), exec);
+    return LinearSystem<DstType, IndexType>(
+        CSRMatrix<DstType, IndexType>(values, colIdxs, rowPtrs), NeoFOAM::convert<DstType>(ls.rhs())
+    );
+}
+
 } // namespace NeoFOAM::la
@@ -7,6 +7,7 @@
 #include <memory>
 
 
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/fields/field.hpp"
 
 #ifdef NF_WITH_MPI_SUPPORT
@@ -89,6 +90,7 @@ public:
     template<typename valueType>
     void startComm(Field<valueType>& field, const std::string& commName)
     {
+        NF_PROFILE_SCOPE("startComm");
         NF_DEBUG_ASSERT(
             CommBuffer_.find(commName) == CommBuffer_.end() || (!CommBuffer_[commName]),
             "There is already an ongoing communication for key " << commName << "."
@@ -126,6 +128,7 @@ public:
     template<typename valueType>
     void finaliseComm(Field<valueType>& field, std::string commName)
     {
+        NF_PROFILE_SCOPE("finaliseComm");
         NF_DEBUG_ASSERT(
             CommBuffer_.find(commName) != CommBuffer_.end() && CommBuffer_[commName],
             "No communication associated with key: " << commName
@@ -3,13 +3,25 @@
 
 #pragma once
 
+#include <optional>
+
 #include "NeoFOAM/fields/fieldTypeDefs.hpp"
+#include "NeoFOAM/fields/storageField.hpp"
 #include "NeoFOAM/mesh/unstructured/boundaryMesh.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/stencil/stencilDataBase.hpp"
 
 namespace NeoFOAM
 {
 
+/**
+ * @brief The geometry arrays of the mesh which kernels can read in reduced precision.
+ */
+enum class GeometryArray
+{
+    cellVolumes,
+    magFaceAreas
+};
+
 /**
  * @class UnstructuredMesh
  * @brief Represents an unstructured mesh in NeoFOAM.
@@ -174,6 +186,49 @@ public:
      */
     const Executor& exec() const;
 
+    /**
+     * @brief Select the precision kernels read a geometry array in.
+     *
+     * The full precision array is kept for all other uses. Reduced precision adds a copy in the
+     * reduced type, which bandwidth bound kernels read instead and widen to scalar, e.g. the
+     * scaling by the cell volumes in computeDiv.
+     *
+     * @param array The geometry array.
+     * @param precision The precision kernels read the array in.
+     */
+    void setPrecision(GeometryArray array, Precision precision);
+
+    /**
+     * @brief Get the precision kernels read a geometry array in.
+     *
+     * @param array The geometry array.
+     * @return The precision of the array.
+     */
+    Precision precision(GeometryArray array) const;
+
+    /**
+     * @brief Call a function with a WideningSpan of the cell volumes in the selected precision.
+     *
+     * @param f The function, it has to accept the spans of both precisions.
+     */
+    template<typename Func>
+    decltype(auto) visitCellVolumes(Func f) const
+    {
+        return visitWidened(cellVolumes_, reducedCellVolumes_, f);
+    }
+
+    /**
+     * @brief Call a function with a WideningSpan of the magnitudes of face areas in the
+     * selected precision.
+     *
+     * @param f The function, it has to accept the spans of both precisions.
+     */
+    template<typename Func>
+    decltype(auto) visitMagFaceAreas(Func f) const
+    {
+        return visitWidened(magFaceAreas_, reducedMagFaceAreas_, f);
+    }
+
 private:
 
     /**
@@ -193,6 +248,11 @@ private:
      */
     scalarField cellVolumes_;
 
+    /**
+     * @brief The cell volumes in reduced precision, if selected.
+     */
+    std::optional<Field<ReducedType<scalar>>> reducedCellVolumes_;
+
     /**
      * @brief Field of cell centres in the mesh.
      */
@@ -216,6 +276,11 @@ private:
      */
     scalarField magFaceAreas_;
 
+    /**
+     * @brief The magnitudes of face areas in reduced precision, if selected.
+     */
+    std::optional<Field<ReducedType<scalar>>> reducedMagFaceAreas_;
+
     /**
      * @brief Field of face owner cells.
      */
@@ -284,4 +349,14 @@ UnstructuredMesh createSingleCellMesh(const Executor exec);
  */
 UnstructuredMesh create1DUniformMesh(const Executor exec, const size_t nCells);
 
+/** @brief A factory function for a 3D box mesh
+ *
+ * A uniform hexahedral mesh of the unit cube with nx * ny * nz cells. Cell i, j, k has the index
+ * i + nx * (j + ny * k). The internal faces normal to x come first, followed by those normal to y
+ * and z. The six boundaries are ordered left, right, bottom, top, back and front, i.e. the faces
+ * at x = 0, x = 1, y = 0, y = 1, z = 0 and z = 1.
+ */
+UnstructuredMesh
+create3DUniformMesh(const Executor exec, const size_t nx, const size_t ny, const size_t nz);
+
 } // namespace NeoFOAM
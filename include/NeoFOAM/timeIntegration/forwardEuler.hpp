@@ -6,6 +6,7 @@
 
 #include "NeoFOAM/core/database/fieldCollection.hpp"
 #include "NeoFOAM/core/database/oldTimeCollection.hpp"
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/fields/field.hpp"
 #include "NeoFOAM/timeIntegration/timeIntegration.hpp"
 
@@ -19,7 +20,8 @@ class ForwardEuler :
 
 public:
 
-    using Expression = NeoFOAM::dsl::Expression;
+    using ValueType = typename SolutionFieldType::FieldValueType;
+    using Expression = NeoFOAM::dsl::Expression<ValueType>;
     using Base =
         TimeIntegratorBase<SolutionFieldType>::template Register<ForwardEuler<SolutionFieldType>>;
 
@@ -35,11 +37,14 @@ public:
         Expression& eqn, SolutionFieldType& solutionField, [[maybe_unused]] scalar t, scalar dt
     ) override
     {
+        Kokkos::Profiling::ScopedRegion region("NeoFOAM::ForwardEuler::solve");
+        NF_PROFILE_SCOPE("forwardEuler");
         auto source = eqn.explicitOperation(solutionField.size());
         SolutionFieldType& oldSolutionField =
             NeoFOAM::finiteVolume::cellCentred::oldTime(solutionField);
 
-        solutionField.internalField() = oldSolutionField.internalField() - source * dt;
+        scalarMul(source, static_cast<ValueType>(dt));
+        solutionField.internalField() = oldSolutionField.internalField() - source;
         solutionField.correctBoundaryConditions();
 
         // check if executor is GPU
@@ -56,5 +61,8 @@ public:
     }
 };
 
+// instantiated in timeIntegration.cpp for both precisions
+extern template class ForwardEuler<finiteVolume::cellCentred::VolumeField<float>>;
+extern template class ForwardEuler<finiteVolume::cellCentred::VolumeField<double>>;
 
 } // namespace NeoFOAM
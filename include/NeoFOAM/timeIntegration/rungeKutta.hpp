@@ -55,7 +55,7 @@ class RungeKutta :
 public:
 
     using ValueType = SolutionFieldType::FieldValueType;
-    using Expression = NeoFOAM::dsl::Expression;
+    using Expression = NeoFOAM::dsl::Expression<ValueType>;
     using Base =
         TimeIntegratorBase<SolutionFieldType>::template Register<RungeKutta<SolutionFieldType>>;
     using Base::dict_;
@@ -143,7 +143,7 @@ private:
     std::unique_ptr<char, decltype(sundials::SUN_ARK_DELETER)> ODEMemory_ {
         nullptr, sundials::SUN_ARK_DELETER
     }; /**< The 'memory' sundails for the RK solver. (note void* is not stl compliant). */
-    std::unique_ptr<NeoFOAM::dsl::Expression> pdeExpr_ {nullptr
+    std::unique_ptr<Expression> pdeExpr_ {nullptr
     }; /**< Pointer to the pde system we are integrating in time. */
 
     /**
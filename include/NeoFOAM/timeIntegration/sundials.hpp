@@ -6,6 +6,7 @@
 #include <concepts>
 #include <functional>
 #include <memory>
+#include <type_traits>
 
 #include <sundials/sundials_nvector.h>
 #include <sundials/sundials_core.hpp>
@@ -74,20 +75,34 @@ ARKODE_ERKTableID stringToERKTable(const std::string& key)
     return ARKODE_ERK_NONE; // avoids compiler warnings.
 }
 
+/**
+ * @brief The SUNDIALS Kokkos vector type in the execution space of an executor.
+ * @tparam ExecutorType The NeoFOAM executor type
+ */
+template<typename ExecutorType>
+using SKVectorType = ::sundials::kokkos::Vector<typename ExecutorType::exec>;
+
 /**
  * @brief Converts NeoFOAM Field data to SUNDIALS N_Vector format.
- * @tparam SKVectorType The SUNDIALS Kokkos vector type
+ * @tparam ExecutorType The executor type of the field
  * @tparam ValueType The field data type
+ * @param exec The executor of the field
  * @param field Source NeoFOAM field
  * @param vector Target SUNDIALS N_Vector
  * @warning Assumes matching initialization and size between field and vector
  */
-template<typename SKVectorType, typename ValueType>
-void fieldToSunNVectorImpl(const NeoFOAM::Field<ValueType>& field, N_Vector& vector)
+template<typename ExecutorType, typename ValueType>
+void fieldToSunNVectorImpl(
+    const ExecutorType& exec, const NeoFOAM::Field<ValueType>& field, N_Vector& vector
+)
 {
-    auto view = ::sundials::kokkos::GetVec<SKVectorType>(vector)->View();
+    auto view = ::sundials::kokkos::GetVec<SKVectorType<ExecutorType>>(vector)->View();
+    auto sField = field.span();
     NeoFOAM::parallelFor(
-        field.exec(), field.range(), KOKKOS_LAMBDA(const size_t i) { view(i) = field[i]; }
+        exec,
+        field.range(),
+        KOKKOS_LAMBDA(const size_t i) { view(i) = static_cast<sunrealtype>(sField[i]); },
+        "sundials::fieldToSunNVector"
     );
 };
 
@@ -96,49 +111,35 @@ void fieldToSunNVectorImpl(const NeoFOAM::Field<ValueType>& field, N_Vector& vec
  * @tparam ValueType The field data type
  * @param field Source NeoFOAM field
  * @param vector Target SUNDIALS N_Vector
- * @throws Runtime error for unsupported executors
  */
 template<typename ValueType>
 void fieldToSunNVector(const NeoFOAM::Field<ValueType>& field, N_Vector& vector)
 {
     // CHECK FOR N_Vector on correct space in DEBUG
-    if (std::holds_alternative<NeoFOAM::GPUExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>>(
-            field, vector
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoFOAM::CPUExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>>(
-            field, vector
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoFOAM::SerialExecutor>(field.exec()))
-    {
-        fieldToSunNVectorImpl<::sundials::kokkos::Vector<Kokkos::Serial>>(field, vector);
-        return;
-    }
-    NF_ERROR_EXIT("Unsupported NeoFOAM executor for field.");
+    std::visit([&](const auto& e) { fieldToSunNVectorImpl(e, field, vector); }, field.exec());
 };
 
 /**
  * @brief Converts SUNDIALS N_Vector data back to NeoFOAM Field format.
- * @tparam SKVectorType The SUNDIALS Kokkos vector type
+ * @tparam ExecutorType The executor type of the field
  * @tparam ValueType The field data type
+ * @param exec The executor of the field
  * @param vector Source SUNDIALS N_Vector
  * @param field Target NeoFOAM field
  * @warning Assumes matching initialization and size between vector and field
  */
-template<typename SKVectorType, typename ValueType>
-void sunNVectorToFieldImpl(const N_Vector& vector, NeoFOAM::Field<ValueType>& field)
+template<typename ExecutorType, typename ValueType>
+void sunNVectorToFieldImpl(
+    const ExecutorType& exec, const N_Vector& vector, NeoFOAM::Field<ValueType>& field
+)
 {
-    auto view = ::sundials::kokkos::GetVec<SKVectorType>(vector)->View();
+    auto view = ::sundials::kokkos::GetVec<SKVectorType<ExecutorType>>(vector)->View();
     ValueType* fieldData = field.data();
     NeoFOAM::parallelFor(
-        field.exec(), field.range(), KOKKOS_LAMBDA(const size_t i) { fieldData[i] = view(i); }
+        exec,
+        field.range(),
+        KOKKOS_LAMBDA(const size_t i) { fieldData[i] = static_cast<ValueType>(view(i)); },
+        "sundials::sunNVectorToField"
     );
 };
 
@@ -151,26 +152,7 @@ void sunNVectorToFieldImpl(const N_Vector& vector, NeoFOAM::Field<ValueType>& fi
 template<typename ValueType>
 void sunNVectorToField(const N_Vector& vector, NeoFOAM::Field<ValueType>& field)
 {
-    if (std::holds_alternative<NeoFOAM::GPUExecutor>(field.exec()))
-    {
-        sunNVectorToFieldImpl<::sundials::kokkos::Vector<Kokkos::DefaultExecutionSpace>>(
-            vector, field
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoFOAM::CPUExecutor>(field.exec()))
-    {
-        sunNVectorToFieldImpl<::sundials::kokkos::Vector<Kokkos::DefaultHostExecutionSpace>>(
-            vector, field
-        );
-        return;
-    }
-    if (std::holds_alternative<NeoFOAM::SerialExecutor>(field.exec()))
-    {
-        sunNVectorToFieldImpl<::sundials::kokkos::Vector<Kokkos::Serial>>(vector, field);
-        return;
-    }
-    NF_ERROR_EXIT("Unsupported NeoFOAM executor for field.");
+    std::visit([&](const auto& e) { sunNVectorToFieldImpl(e, vector, field); }, field.exec());
 };
 
 /**
@@ -190,8 +172,9 @@ void sunNVectorToField(const N_Vector& vector, NeoFOAM::Field<ValueType>& field)
 template<typename SolutionFieldType>
 int explicitRKSolve([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, void* userData)
 {
+    using ValueType = typename SolutionFieldType::FieldValueType;
     // Pointer wrangling
-    NeoFOAM::dsl::Expression* pdeExpre = reinterpret_cast<NeoFOAM::dsl::Expression*>(userData);
+    auto* pdeExpre = reinterpret_cast<NeoFOAM::dsl::Expression<ValueType>*>(userData);
     sunrealtype* yDotArray = N_VGetArrayPointer(ydot);
     sunrealtype* yArray = N_VGetArrayPointer(y);
 
@@ -202,8 +185,8 @@ int explicitRKSolve([[maybe_unused]] sunrealtype t, N_Vector y, N_Vector ydot, v
 
     size_t size = static_cast<size_t>(N_VGetLength(y));
     // Copy initial value from y to source.
-    NeoFOAM::Field<NeoFOAM::scalar> source =
-        pdeExpre->explicitOperation(size) * -1.0; // compute spatial
+    NeoFOAM::Field<ValueType> source = pdeExpre->explicitOperation(size); // compute spatial
+    scalarMul(source, ValueType(-1));
     if (std::holds_alternative<NeoFOAM::GPUExecutor>(pdeExpre->exec()))
     {
         Kokkos::fence();
@@ -376,6 +359,20 @@ public:
     using SKDefaultVectorV = SKVectorDefault<ValueType>;
     using SKVectorVariant = std::variant<SKVectorSerialV, SKVectorHostDefaultV, SKDefaultVectorV>;
 
+    /**
+     * @brief The vector implementation matching an executor type.
+     * @tparam ExecutorType The NeoFOAM executor type
+     */
+    template<typename ExecutorType>
+    using SKVectorOf = std::conditional_t<
+        std::is_same_v<ExecutorType, NeoFOAM::SerialExecutor>,
+        SKVectorSerialV,
+        std::conditional_t<
+            std::is_same_v<ExecutorType, NeoFOAM::CPUExecutor>
+                || std::is_same_v<ExecutorType, NeoFOAM::PoolExecutor>,
+            SKVectorHostDefaultV,
+            SKDefaultVectorV>>;
+
     /**
      * @brief Default constructor. Initializes with host-default vector.
      */
@@ -414,25 +411,10 @@ public:
      */
     void setExecutor(const NeoFOAM::Executor& exec)
     {
-        if (std::holds_alternative<NeoFOAM::GPUExecutor>(exec))
-        {
-            vector_.template emplace<SKDefaultVectorV>();
-            return;
-        }
-        if (std::holds_alternative<NeoFOAM::CPUExecutor>(exec))
-        {
-            vector_.template emplace<SKVectorHostDefaultV>();
-            return;
-        }
-        if (std::holds_alternative<NeoFOAM::SerialExecutor>(exec))
-        {
-            vector_.template emplace<SKVectorSerialV>();
-            return;
-        }
-
-        NF_ERROR_EXIT(
-            "Unsupported NeoFOAM executor: "
-            << std::visit([](const auto& e) { return e.name(); }, exec) << "."
+        std::visit(
+            [this](const auto& e)
+            { vector_.template emplace<SKVectorOf<std::decay_t<decltype(e)>>>(); },
+            exec
         );
     }
 
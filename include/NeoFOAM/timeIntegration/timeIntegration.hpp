@@ -6,6 +6,7 @@
 
 #include <functional>
 
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/fields/field.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred.hpp"
 #include "NeoFOAM/dsl/expression.hpp"
@@ -23,7 +24,8 @@ class TimeIntegratorBase :
 
 public:
 
-    using Expression = NeoFOAM::dsl::Expression;
+    using ValueType = typename SolutionType::FieldValueType;
+    using Expression = NeoFOAM::dsl::Expression<ValueType>;
 
     static std::string name() { return "timeIntegrationFactory"; }
 
@@ -55,7 +57,8 @@ class TimeIntegration
 
 public:
 
-    using Expression = NeoFOAM::dsl::Expression;
+    using ValueType = typename SolutionFieldType::FieldValueType;
+    using Expression = NeoFOAM::dsl::Expression<ValueType>;
 
     TimeIntegration(const TimeIntegration& timeIntegrator)
         : timeIntegratorStrategy_(timeIntegrator.timeIntegratorStrategy_->clone()) {};
@@ -70,6 +73,7 @@ public:
 
     void solve(Expression& eqn, SolutionFieldType& sol, scalar t, scalar dt)
     {
+        NF_PROFILE_SCOPE("timeIntegration");
         timeIntegratorStrategy_->solve(eqn, sol, t, dt);
     }
 
@@ -2,44 +2,105 @@
 # SPDX-FileCopyrightText: 2023-2025 NeoFOAM authors
 
 import xmltodict
+import argparse
 import json
+import math
 import sys
 import os
+import re
+
+
+def as_list(d):
+    """xmltodict returns a dict for a single child and a list otherwise"""
+    return d if isinstance(d, list) else [d]
+
+
+ROOFLINE = re.compile(
+    r"roofline \[.*\]: (?P<bandwidth>[\d.]+) GB/s, (?P<gflops>[\d.]+) GFLOP/s, "
+    r"(?P<stream>[\d.]+) % of STREAM triad"
+)
+
+
+def parse_roofline(warnings):
+    """extract the figures of the RooflineListener from the warnings of a
+    benchmark"""
+    res = {}
+    for w in as_list(warnings):
+        text = w if isinstance(w, str) else w.get("#text", "")
+        m = ROOFLINE.search(text)
+        if m:
+            res["bandwidth"] = float(m["bandwidth"])
+            res["gflops"] = float(m["gflops"])
+            res["streamTriadFraction"] = float(m["stream"]) / 100
+    return res
+
+
+THROUGHPUT = re.compile(
+    r"throughput \[(?P<executor>.*?)\]: (?P<ms>[\d.e+-]+) ms/step, "
+    r"(?P<cells>[\d.e+-]+) cells/s"
+)
+PHASE = re.compile(r"phase \[(?P<executor>.*?)\] (?P<path>\S+): (?P<ms>[\d.e+-]+) ms/step")
+
+
+def parse_throughput(warnings, executor):
+    """extract the time per step, the throughput and the time of each phase
+    reported by a mini-app for an executor from the warnings of a section"""
+    res = {}
+    for w in as_list(warnings):
+        text = w if isinstance(w, str) else w.get("#text", "")
+        for m in THROUGHPUT.finditer(text):
+            if m["executor"] == executor:
+                res["timePerStep"] = float(m["ms"]) * 1e-3
+                res["cellsPerSecond"] = float(m["cells"])
+        for m in PHASE.finditer(text):
+            if m["executor"] == executor:
+                res.setdefault("phases", {})[m["path"]] = float(m["ms"]) * 1e-3
+    return res
 
 
 def parse_xml_dict(d):
     """takes the catch2 xml dict, performs clean-up and returns a
     list of records"""
-    data = d["Catch2TestRun"]["TestCase"]
-    if isinstance(data, dict):
-        data = [data]
+    data = as_list(d["Catch2TestRun"]["TestCase"])
     records = []
     for cases in data:
         test_case = cases["@name"]
-        for d in cases["Section"]:
+        for d in as_list(cases.get("Section", [])):
             size = d["@name"]
-            res = {}
-            for k, v in d["BenchmarkResults"].items():
-                # print(k, v)
-                if k == "@name":
-                    res["executor"] = v
-                if k == "mean":
-                    res["mean"] = v["@value"]
-                    continue
-                if k == "standardDeviation":
-                    res["standardDeviation"] = v["@value"]
-                    continue
-                if k.startswith("@"):
-                    continue
-            res["size"] = size
-            res["test_case"] = test_case
-            records.append(res)
+            for bench in as_list(d.get("BenchmarkResults", [])):
+                res = {}
+                for k, v in bench.items():
+                    if k == "@name":
+                        res["executor"] = v
+                    if k == "mean":
+                        res["mean"] = v["@value"]
+                        continue
+                    if k == "standardDeviation":
+                        res["standardDeviation"] = v["@value"]
+                        continue
+                    if k == "Warning":
+                        res.update(parse_roofline(v))
+                        continue
+                    if k.startswith("@"):
+                        continue
+                res.update(parse_throughput(d.get("Warning", []), res["executor"]))
+                res["size"] = size
+                res["test_case"] = test_case
+                records.append(res)
     return records
 
 
-def main():
+def key(record):
+    """the key of a record in the baseline"""
+    return "{}/{}/{}".format(record["test_case"], record["size"], record["executor"])
+
+
+def read_records():
+    """convert all xml files in the current directory to json files
+    and return the records of all of them"""
     _, _, files = next(os.walk("."))
-    for xml_file in files:
+    records = []
+    for xml_file in sorted(files):
         if not xml_file.endswith("xml"):
             continue
         try:
@@ -48,9 +109,133 @@ def main():
                 res = parse_xml_dict(d)
             with open(xml_file.replace("xml", "json"), "w") as outfile:
                 json.dump(res, outfile)
+            records += res
         except Exception as e:
-            print(e)
+            print("ERROR: could not read {}: {}".format(xml_file, e))
+    return records
+
+
+def store_baseline(records, baseline_file):
+    """write the mean and standard deviation of each record to the baseline"""
+    baseline = {
+        key(r): {
+            "mean": float(r["mean"]),
+            "standardDeviation": float(r["standardDeviation"]),
+        }
+        for r in records
+    }
+    with open(baseline_file, "w") as outfile:
+        json.dump(baseline, outfile, indent=2, sort_keys=True)
+    print("stored {} benchmarks in {}".format(len(baseline), baseline_file))
+
+
+def compare(records, baseline_file, threshold, n_sigma):
+    """compare the records against the baseline and return the number of
+    regressions and of baseline entries missing from the records
+
+    A benchmark regresses if its mean increased by more than the relative
+    threshold and the increase exceeds n_sigma combined standard deviations,
+    so that noisy benchmarks do not raise false alarms.
+    """
+    with open(baseline_file, "r") as fh:
+        baseline = json.load(fh)
+
+    regressions = 0
+    for r in records:
+        k = key(r)
+        if k not in baseline:
+            print("NEW        {}".format(k))
+            continue
+        base = baseline[k]
+        mean = float(r["mean"])
+        diff = mean - base["mean"]
+        sigma = math.hypot(float(r["standardDeviation"]), base["standardDeviation"])
+        rel = diff / base["mean"] if base["mean"] > 0 else 0.0
+        if diff > threshold * base["mean"] and diff > n_sigma * sigma:
+            status = "REGRESSION"
+            regressions += 1
+        elif -diff > threshold * base["mean"] and -diff > n_sigma * sigma:
+            status = "IMPROVED"
+        else:
+            status = "OK"
+        print(
+            "{:<10} {} {:+.1f}% ({:.4g} ns -> {:.4g} ns)".format(
+                status, k, 100 * rel, base["mean"], mean
+            )
+        )
+
+    current = {key(r) for r in records}
+    missing = sorted(k for k in baseline if k not in current)
+    for k in missing:
+        print("MISSING    {}".format(k))
+    return regressions, len(missing)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert the catch2 xml files of the benchmarks in the "
+        "current directory to json and optionally store or compare them "
+        "against a baseline."
+    )
+    parser.add_argument("--baseline", help="the baseline json file")
+    parser.add_argument(
+        "--store",
+        action="store_true",
+        help="store the results as new baseline instead of comparing",
+    )
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="relative slowdown of the mean tolerated (default: 0.05)",
+    )
+    parser.add_argument(
+        "--sigma",
+        type=float,
+        default=2.0,
+        help="number of combined standard deviations a slowdown has to "
+        "exceed to be significant (default: 2)",
+    )
+    parser.add_argument(
+        "--allow-missing",
+        action="store_true",
+        help="only warn about baseline benchmarks missing from the current "
+        "results, e.g. when running a subset of the benchmarks",
+    )
+    parser.add_argument(
+        "--warn-only",
+        action="store_true",
+        help="report regressions without failing",
+    )
+    args = parser.parse_args()
+
+    records = read_records()
+    if not args.baseline:
+        return 0
+    if not records:
+        # an empty run must neither overwrite the baseline nor pass the comparison
+        print("ERROR: no benchmark results found in the xml files of the current directory")
+        return 1
+    if args.store:
+        store_baseline(records, args.baseline)
+        return 0
+
+    regressions, missing = compare(records, args.baseline, args.threshold, args.sigma)
+    failed = False
+    if missing > 0:
+        print(
+            "{}: {} benchmark(s) of the baseline are missing from the current results".format(
+                "WARNING" if args.allow_missing or args.warn_only else "ERROR", missing
+            )
+        )
+        failed = not args.allow_missing
+    if regressions > 0:
+        print("{} benchmark(s) regressed".format(regressions))
+        failed = True
+    if failed and not args.warn_only:
+        return 1
+    return 0
 
 
 if __name__ == "__main__":
-    main()
+    sys.exit(main())
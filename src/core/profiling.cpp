@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/profiling.hpp"
+
+namespace NeoFOAM::profiling
+{
+
+namespace
+{
+
+std::string indentedName(const std::string& path, size_t depth)
+{
+    return std::string(2 * depth, ' ') + path.substr(path.find_last_of('/') + 1);
+}
+
+size_t nameWidth(const auto& stats)
+{
+    size_t width = 6;
+    for (const auto& region : stats)
+    {
+        width = std::max(width, indentedName(region.path, region.depth).size());
+    }
+    return width;
+}
+
+}
+
+Profiler& Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::~Profiler()
+{
+    if (reportAtExit_)
+    {
+        print(std::cout);
+    }
+    if (!jsonFile_.empty())
+    {
+        std::ofstream out(jsonFile_);
+        writeJson(out);
+    }
+}
+
+void Profiler::start(const std::string& name)
+{
+    std::string path = open_.empty() ? name : regions_[open_.back().index].path + "/" + name;
+    auto [it, inserted] = index_.try_emplace(path, regions_.size());
+    if (inserted)
+    {
+        regions_.push_back(RegionStats {path, open_.size()});
+    }
+    if (fence_)
+    {
+        Kokkos::fence();
+    }
+    open_.push_back({it->second, clock::now()});
+}
+
+void Profiler::stop()
+{
+    NF_ASSERT(!open_.empty(), "No profiling region to stop.");
+    if (fence_)
+    {
+        Kokkos::fence();
+    }
+    double elapsed = std::chrono::duration<double>(clock::now() - open_.back().start).count();
+    RegionStats& region = regions_[open_.back().index];
+    open_.pop_back();
+
+    region.min = region.count == 0 ? elapsed : std::min(region.min, elapsed);
+    region.max = std::max(region.max, elapsed);
+    region.total += elapsed;
+    region.count++;
+}
+
+void Profiler::setReportAtExit(bool enable, const std::string& jsonFile)
+{
+    reportAtExit_ = enable;
+    jsonFile_ = jsonFile;
+}
+
+void Profiler::reset()
+{
+    NF_ASSERT(open_.empty(), "Cannot reset the profiler while regions are open.");
+    regions_.clear();
+    index_.clear();
+}
+
+void Profiler::print(std::ostream& out) const
+{
+    size_t width = nameWidth(regions_);
+    out << std::left << std::setw(static_cast<int>(width)) << "Region" << std::right
+        << std::setw(10) << "count" << std::setw(14) << "total [s]" << std::setw(14) << "avg [s]"
+        << std::setw(14) << "min [s]" << std::setw(14) << "max [s]" << "\n";
+    for (const auto& region : regions_)
+    {
+        out << std::left << std::setw(static_cast<int>(width))
+            << indentedName(region.path, region.depth) << std::right << std::setw(10)
+            << region.count << std::scientific << std::setprecision(4) << std::setw(14)
+            << region.total << std::setw(14) << region.avg() << std::setw(14) << region.min
+            << std::setw(14) << region.max << std::defaultfloat << "\n";
+    }
+}
+
+void Profiler::writeJson(std::ostream& out) const
+{
+    out << "[";
+    for (size_t i = 0; i < regions_.size(); i++)
+    {
+        const auto& region = regions_[i];
+        out << (i == 0 ? "\n" : ",\n") << "  {\"path\": \"" << region.path
+            << "\", \"depth\": " << region.depth << ", \"count\": " << region.count
+            << ", \"total\": " << region.total << ", \"avg\": " << region.avg()
+            << ", \"min\": " << region.min << ", \"max\": " << region.max << "}";
+    }
+    out << "\n]\n";
+}
+
+std::vector<AggregatedRegionStats>
+Profiler::merge(const std::vector<std::vector<RegionStats>>& rankStats)
+{
+    std::vector<AggregatedRegionStats> result;
+    std::unordered_map<std::string, size_t> index;
+    for (const auto& stats : rankStats)
+    {
+        for (const auto& region : stats)
+        {
+            auto [it, inserted] = index.try_emplace(region.path, result.size());
+            if (inserted)
+            {
+                result.push_back(
+                    {region.path, region.depth, 0, 0, region.total, 0.0, region.total}
+                );
+            }
+            auto& merged = result[it->second];
+            merged.nRanks++;
+            merged.count += region.count;
+            merged.minTotal = std::min(merged.minTotal, region.total);
+            merged.maxTotal = std::max(merged.maxTotal, region.total);
+            merged.avgTotal += region.total;
+        }
+    }
+    // ranks that did not enter a region contribute zero to its average
+    for (auto& merged : result)
+    {
+        if (merged.nRanks < rankStats.size())
+        {
+            merged.minTotal = 0.0;
+        }
+        merged.avgTotal /= static_cast<double>(rankStats.size());
+    }
+    return result;
+}
+
+void Profiler::print(const std::vector<AggregatedRegionStats>& stats, std::ostream& out)
+{
+    size_t width = nameWidth(stats);
+    out << std::left << std::setw(static_cast<int>(width)) << "Region" << std::right
+        << std::setw(8) << "ranks" << std::setw(10) << "count" << std::setw(14) << "min [s]"
+        << std::setw(14) << "avg [s]" << std::setw(14) << "max [s]" << "\n";
+    for (const auto& region : stats)
+    {
+        out << std::left << std::setw(static_cast<int>(width))
+            << indentedName(region.path, region.depth) << std::right << std::setw(8)
+            << region.nRanks << std::setw(10) << region.count << std::scientific
+            << std::setprecision(4) << std::setw(14) << region.minTotal << std::setw(14)
+            << region.avgTotal << std::setw(14) << region.maxTotal << std::defaultfloat << "\n";
+    }
+}
+
+void Profiler::writeJson(const std::vector<AggregatedRegionStats>& stats, std::ostream& out)
+{
+    out << "[";
+    for (size_t i = 0; i < stats.size(); i++)
+    {
+        const auto& region = stats[i];
+        out << (i == 0 ? "\n" : ",\n") << "  {\"path\": \"" << region.path
+            << "\", \"depth\": " << region.depth << ", \"ranks\": " << region.nRanks
+            << ", \"count\": " << region.count << ", \"min\": " << region.minTotal
+            << ", \"avg\": " << region.avgTotal << ", \"max\": " << region.maxTotal << "}";
+    }
+    out << "\n]\n";
+}
+
+std::string Profiler::serialize(const std::vector<RegionStats>& stats)
+{
+    std::ostringstream out;
+    out << std::setprecision(17);
+    for (const auto& region : stats)
+    {
+        out << region.path << '\t' << region.depth << '\t' << region.count << '\t' << region.total
+            << '\t' << region.min << '\t' << region.max << '\n';
+    }
+    return out.str();
+}
+
+std::vector<RegionStats> Profiler::deserialize(const std::string& data)
+{
+    std::vector<RegionStats> stats;
+    std::istringstream in(data);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::istringstream fields(line);
+        RegionStats region;
+        std::getline(fields, region.path, '\t');
+        fields >> region.depth >> region.count >> region.total >> region.min >> region.max;
+        stats.push_back(region);
+    }
+    return stats;
+}
+
+} // namespace NeoFOAM::profiling
@@ -54,7 +54,10 @@ void toField(Coeff& coeff, Field<scalar>& rhs)
         auto rhsSpan = rhs.span();
         // otherwise we are unable to capture values in the lambda
         parallelFor(
-            rhs.exec(), rhs.range(), KOKKOS_LAMBDA(const size_t i) { rhsSpan[i] *= coeff[i]; }
+            rhs.exec(),
+            rhs.range(),
+            KOKKOS_LAMBDA(const size_t i) { rhsSpan[i] *= coeff[i]; },
+            "dsl::toField"
         );
     }
     else
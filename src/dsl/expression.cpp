@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#include "NeoFOAM/dsl/expression.hpp"
+
+namespace NeoFOAM::dsl
+{
+
+// instantiated for both precisions, independent of the precision selected for scalar
+template class Expression<float>;
+template class Expression<double>;
+
+} // namespace NeoFOAM::dsl
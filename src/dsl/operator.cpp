@@ -7,44 +7,89 @@ namespace NeoFOAM::dsl
 {
 
 
-Operator::Operator(const Operator& eqnOperator) : model_ {eqnOperator.model_->clone()} {}
+template<typename ValueType>
+Operator<ValueType>::Operator(const Operator& eqnOperator) : model_ {eqnOperator.model_->clone()}
+{}
 
-Operator::Operator(Operator&& eqnOperator) : model_ {std::move(eqnOperator.model_)} {}
+template<typename ValueType>
+Operator<ValueType>::Operator(Operator&& eqnOperator) : model_ {std::move(eqnOperator.model_)}
+{}
 
-void Operator::explicitOperation(Field<scalar>& source) { model_->explicitOperation(source); }
+template<typename ValueType>
+void Operator<ValueType>::explicitOperation(Field<ValueType>& source)
+{
+    model_->explicitOperation(source);
+}
 
-void Operator::temporalOperation(Field<scalar>& field) { model_->temporalOperation(field); }
+template<typename ValueType>
+void Operator<ValueType>::temporalOperation(Field<ValueType>& field)
+{
+    model_->temporalOperation(field);
+}
 
-Operator::Type Operator::getType() const { return model_->getType(); }
+template<typename ValueType>
+OperatorType Operator<ValueType>::getType() const
+{
+    return model_->getType();
+}
 
-Coeff& Operator::getCoefficient() { return model_->getCoefficient(); }
+template<typename ValueType>
+Coeff& Operator<ValueType>::getCoefficient()
+{
+    return model_->getCoefficient();
+}
 
-Coeff Operator::getCoefficient() const { return model_->getCoefficient(); }
+template<typename ValueType>
+Coeff Operator<ValueType>::getCoefficient() const
+{
+    return model_->getCoefficient();
+}
 
-void Operator::build(const Input& input) { model_->build(input); }
+template<typename ValueType>
+void Operator<ValueType>::build(const Input& input)
+{
+    model_->build(input);
+}
 
-const Executor& Operator::exec() const { return model_->exec(); }
+template<typename ValueType>
+const Executor& Operator<ValueType>::exec() const
+{
+    return model_->exec();
+}
 
-Operator operator*(scalar scalarCoeff, Operator rhs)
+template<typename ValueType>
+Operator<ValueType> operator*(scalar scalarCoeff, Operator<ValueType> rhs)
 {
-    Operator result = rhs;
+    Operator<ValueType> result = rhs;
     result.getCoefficient() *= scalarCoeff;
     return result;
 }
 
-Operator operator*(const Field<scalar>& coeffField, Operator rhs)
+template<typename ValueType>
+Operator<ValueType> operator*(const Field<scalar>& coeffField, Operator<ValueType> rhs)
 {
-    Operator result = rhs;
+    Operator<ValueType> result = rhs;
     result.getCoefficient() *= Coeff(coeffField);
     return result;
 }
 
-Operator operator*(const Coeff& coeff, Operator rhs)
+template<typename ValueType>
+Operator<ValueType> operator*(const Coeff& coeff, Operator<ValueType> rhs)
 {
-    Operator result = rhs;
+    Operator<ValueType> result = rhs;
     result.getCoefficient() *= coeff;
     return result;
 }
 
+// instantiated for both precisions, independent of the precision selected for scalar
+template class Operator<float>;
+template class Operator<double>;
+
+template Operator<float> operator*(scalar, Operator<float>);
+template Operator<double> operator*(scalar, Operator<double>);
+template Operator<float> operator*(const Field<scalar>&, Operator<float>);
+template Operator<double> operator*(const Field<scalar>&, Operator<double>);
+template Operator<float> operator*(const Coeff&, Operator<float>);
+template Operator<double> operator*(const Coeff&, Operator<double>);
 
 } // namespace NeoFOAM::dsl
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#include <iomanip>
+
+#include "NeoFOAM/core/executor/allocationCounter.hpp"
+
+namespace NeoFOAM
+{
+
+AllocationStats& AllocationStats::operator+=(const AllocationStats& rhs)
+{
+    nAllocations += rhs.nAllocations;
+    nFrees += rhs.nFrees;
+    bytesAllocated += rhs.bytesAllocated;
+    bytesFreed += rhs.bytesFreed;
+    nHugePages += rhs.nHugePages;
+    bytesHugePages += rhs.bytesHugePages;
+    nRealigned += rhs.nRealigned;
+    return *this;
+}
+
+AllocationCounter& AllocationCounter::instance()
+{
+    static AllocationCounter counter;
+    return counter;
+}
+
+void AllocationCounter::recordAlloc(
+    void* ptr, size_t bytes, const std::string& label, AllocationTraits traits
+)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& stats = stats_[label];
+    stats.nAllocations++;
+    stats.bytesAllocated += bytes;
+    if (traits.hugePages)
+    {
+        stats.nHugePages++;
+        stats.bytesHugePages += bytes;
+    }
+    if (traits.realigned)
+    {
+        stats.nRealigned++;
+    }
+    live_[ptr] = {bytes, label};
+}
+
+void AllocationCounter::recordRealloc(
+    void* oldPtr, void* newPtr, size_t bytes, AllocationTraits traits
+)
+{
+    std::string label = "Field";
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto it = live_.find(oldPtr); it != live_.end())
+        {
+            label = it->second.label;
+        }
+    }
+    recordFree(oldPtr);
+    recordAlloc(newPtr, bytes, label, traits);
+}
+
+void AllocationCounter::recordFree(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = live_.find(ptr);
+    if (it == live_.end())
+    {
+        return;
+    }
+    auto& stats = stats_[it->second.label];
+    stats.nFrees++;
+    stats.bytesFreed += it->second.bytes;
+    live_.erase(it);
+}
+
+AllocationStats AllocationCounter::total() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    AllocationStats result;
+    for (const auto& [label, stats] : stats_)
+    {
+        result += stats;
+    }
+    return result;
+}
+
+AllocationStats AllocationCounter::stats(const std::string& label) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = stats_.find(label);
+    return it != stats_.end() ? it->second : AllocationStats {};
+}
+
+std::map<std::string, AllocationStats> AllocationCounter::statsPerLabel() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void AllocationCounter::reset()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.clear();
+}
+
+void AllocationCounter::print(std::ostream& out) const
+{
+    auto stats = statsPerLabel();
+    size_t width = 5;
+    for (const auto& [label, labelStats] : stats)
+    {
+        width = std::max(width, label.size());
+    }
+    out << std::left << std::setw(static_cast<int>(width)) << "Label" << std::right
+        << std::setw(10) << "allocs" << std::setw(10) << "frees" << std::setw(16)
+        << "allocated [B]" << std::setw(16) << "freed [B]" << std::setw(12) << "huge pages"
+        << std::setw(12) << "realigned" << "\n";
+    for (const auto& [label, labelStats] : stats)
+    {
+        out << std::left << std::setw(static_cast<int>(width)) << label << std::right
+            << std::setw(10) << labelStats.nAllocations << std::setw(10) << labelStats.nFrees
+            << std::setw(16) << labelStats.bytesAllocated << std::setw(16)
+            << labelStats.bytesFreed << std::setw(12) << labelStats.nHugePages << std::setw(12)
+            << labelStats.nRealigned << "\n";
+    }
+}
+
+} // namespace NeoFOAM
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#include "NeoFOAM/core/executor/allocationPolicy.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace NeoFOAM::detail
+{
+
+// the huge page size of x86-64 and most aarch64 kernels
+constexpr size_t hugePageSize = size_t {1} << 21;
+
+PolicyAllocations& PolicyAllocations::instance()
+{
+    static PolicyAllocations allocations;
+    return allocations;
+}
+
+void PolicyAllocations::insert(void* ptr, Allocation allocation)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    allocations_[ptr] = allocation;
+    size_ = allocations_.size();
+}
+
+std::optional<PolicyAllocations::Allocation> PolicyAllocations::extract(void* ptr)
+{
+    if (size_ == 0 || ptr == nullptr)
+    {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = allocations_.find(ptr);
+    if (it == allocations_.end())
+    {
+        return std::nullopt;
+    }
+    auto allocation = it->second;
+    allocations_.erase(it);
+    size_ = allocations_.size();
+    return allocation;
+}
+
+std::optional<size_t> PolicyAllocations::bytes(void* ptr) const
+{
+    if (size_ == 0 || ptr == nullptr)
+    {
+        return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = allocations_.find(ptr);
+    if (it == allocations_.end())
+    {
+        return std::nullopt;
+    }
+    return it->second.bytes;
+}
+
+void* mapHugePages([[maybe_unused]] size_t bytes)
+{
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    const size_t length = (bytes + hugePageSize - 1) / hugePageSize * hugePageSize;
+    void* ptr = mmap(
+        nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0
+    );
+    return ptr == MAP_FAILED ? nullptr : ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void unmapHugePages([[maybe_unused]] void* ptr, [[maybe_unused]] size_t bytes)
+{
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    munmap(ptr, (bytes + hugePageSize - 1) / hugePageSize * hugePageSize);
+#endif
+}
+
+bool adviseHugePages([[maybe_unused]] void* ptr, [[maybe_unused]] size_t bytes)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // only whole huge pages within the allocation can be backed by a huge page
+    const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+    const auto begin = (address + hugePageSize - 1) / hugePageSize * hugePageSize;
+    const auto end = (address + bytes) / hugePageSize * hugePageSize;
+    if (end <= begin)
+    {
+        return false;
+    }
+    return madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
+
+} // namespace NeoFOAM::detail
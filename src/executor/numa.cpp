@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/executor/numa.hpp"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)                         \
+    && defined(SYS_move_pages)
+#define NF_WITH_NUMA_SYSCALLS
+#endif
+
+namespace NeoFOAM
+{
+
+namespace detail
+{
+
+std::atomic<NumaPolicy>& numaPolicy()
+{
+    static std::atomic<NumaPolicy> policy {NumaPolicy::firstTouch};
+    return policy;
+}
+
+std::atomic<size_t>& numaThreshold()
+{
+    static std::atomic<size_t> threshold {size_t(1) << 20};
+    return threshold;
+}
+
+size_t pageSize()
+{
+#if defined(__linux__)
+    static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+#ifdef NF_WITH_NUMA_SYSCALLS
+// the constants of numaif.h, which is part of libnuma and not available everywhere
+constexpr int mpolInterleave = 3;
+constexpr unsigned mpolMfMove = 1 << 1;
+constexpr unsigned long mpolFMemsAllowed = 1 << 2;
+constexpr size_t maxNodes = 1024;
+constexpr size_t bitsPerWord = 8 * sizeof(unsigned long);
+
+/* @brief the nodes the process may allocate memory on, empty if the query failed */
+std::vector<unsigned long> allowedNodes()
+{
+    std::vector<unsigned long> mask(maxNodes / bitsPerWord, 0);
+    if (syscall(SYS_get_mempolicy, nullptr, mask.data(), maxNodes, nullptr, mpolFMemsAllowed)
+        != 0)
+    {
+        mask.clear();
+    }
+    return mask;
+}
+
+void interleave(void* ptr, size_t bytes)
+{
+    static const std::vector<unsigned long> mask = allowedNodes();
+    if (mask.empty())
+    {
+        return;
+    }
+    // mbind only accepts whole pages, the partial pages at the ends keep the default policy
+    const auto size = pageSize();
+    const auto begin = (reinterpret_cast<std::uintptr_t>(ptr) + size - 1) / size * size;
+    const auto end = (reinterpret_cast<std::uintptr_t>(ptr) + bytes) / size * size;
+    if (end <= begin)
+    {
+        return;
+    }
+    // the kernel ignores the last bit of maxnode
+    syscall(
+        SYS_mbind,
+        reinterpret_cast<void*>(begin),
+        end - begin,
+        mpolInterleave,
+        mask.data(),
+        maxNodes + 1,
+        mpolMfMove
+    );
+}
+#endif
+
+}
+
+NumaPolicy numaPolicy() { return detail::numaPolicy(); }
+
+void setNumaPolicy(NumaPolicy policy) { detail::numaPolicy() = policy; }
+
+size_t numaThreshold() { return detail::numaThreshold(); }
+
+void setNumaThreshold(size_t bytes) { detail::numaThreshold() = bytes; }
+
+void placePages(void* ptr, size_t bytes)
+{
+    const auto policy = numaPolicy();
+    const auto size = detail::pageSize();
+    if (ptr == nullptr || policy == NumaPolicy::none || bytes < 2 * size
+        || bytes < numaThreshold())
+    {
+        return;
+    }
+#ifdef NF_WITH_NUMA_SYSCALLS
+    if (policy == NumaPolicy::interleave)
+    {
+        detail::interleave(ptr, bytes);
+    }
+#endif
+
+    // write one byte of each page, the first page may start before the allocation
+    char* begin = static_cast<char*>(ptr);
+    char* firstPage = begin - reinterpret_cast<std::uintptr_t>(ptr) % size;
+    const size_t nPages = (static_cast<size_t>(begin - firstPage) + bytes + size - 1) / size;
+    using runOn = Kokkos::DefaultHostExecutionSpace;
+    Kokkos::parallel_for(
+        "NeoFOAM::placePages",
+        Kokkos::RangePolicy<runOn, Kokkos::Schedule<Kokkos::Static>>(0, nPages),
+        [=](const size_t i) { *std::max(firstPage + i * size, begin) = 0; }
+    );
+    runOn().fence();
+}
+
+double PagePlacement::fraction(size_t node) const
+{
+    const size_t nPlaced = nPages - nUnplaced;
+    if (node >= pagesPerNode.size() || nPlaced == 0)
+    {
+        return 0.0;
+    }
+    return static_cast<double>(pagesPerNode[node]) / static_cast<double>(nPlaced);
+}
+
+void PagePlacement::print(std::ostream& out) const
+{
+    out << std::left << std::setw(10) << "Node" << std::right << std::setw(12) << "pages"
+        << std::setw(12) << "fraction" << "\n";
+    for (size_t node = 0; node < pagesPerNode.size(); node++)
+    {
+        out << std::left << std::setw(10) << node << std::right << std::setw(12)
+            << pagesPerNode[node] << std::setw(12) << std::fixed << std::setprecision(3)
+            << fraction(node) << "\n";
+    }
+    out << std::left << std::setw(10) << "unplaced" << std::right << std::setw(12) << nUnplaced
+        << "\n";
+}
+
+PagePlacement pagePlacement(const void* ptr, size_t bytes)
+{
+    PagePlacement result;
+    if (ptr == nullptr || bytes == 0)
+    {
+        return result;
+    }
+    const auto size = detail::pageSize();
+    const auto begin = reinterpret_cast<std::uintptr_t>(ptr) / size * size;
+    const auto end = reinterpret_cast<std::uintptr_t>(ptr) + bytes;
+    result.nPages = (end - begin + size - 1) / size;
+    result.nUnplaced = result.nPages;
+#ifdef NF_WITH_NUMA_SYSCALLS
+    // query in chunks to bound the size of the temporary arrays
+    const size_t chunk = 4096;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    for (size_t first = 0; first < result.nPages; first += chunk)
+    {
+        const size_t count = std::min(chunk, result.nPages - first);
+        pages.resize(count);
+        status.assign(count, -1);
+        for (size_t i = 0; i < count; i++)
+        {
+            pages[i] = reinterpret_cast<void*>(begin + (first + i) * size);
+        }
+        // without target nodes move_pages only reports the node of each page
+        if (syscall(SYS_move_pages, 0, count, pages.data(), nullptr, status.data(), 0) != 0)
+        {
+            continue;
+        }
+        for (auto node : status)
+        {
+            if (node < 0)
+            {
+                continue;
+            }
+            const auto n = static_cast<size_t>(node);
+            if (n >= result.pagesPerNode.size())
+            {
+                result.pagesPerNode.resize(n + 1, 0);
+            }
+            result.pagesPerNode[n]++;
+            result.nUnplaced--;
+        }
+    }
+#endif
+    return result;
+}
+
+} // namespace NeoFOAM
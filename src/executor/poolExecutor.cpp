@@ -0,0 +1,8 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#include "NeoFOAM/core/executor/poolExecutor.hpp"
+
+NeoFOAM::PoolExecutor::PoolExecutor() {};
+
+NeoFOAM::PoolExecutor::~PoolExecutor() {};
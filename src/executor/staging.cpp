@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#include <algorithm>
+#include <bit>
+#include <optional>
+
+#include "NeoFOAM/core/executor/staging.hpp"
+
+namespace NeoFOAM
+{
+
+StagingBuffer::StagingBuffer(StagingBuffer&& other) noexcept
+    : data_(other.data_), bytes_(other.bytes_)
+{
+    other.data_ = nullptr;
+    other.bytes_ = 0;
+}
+
+StagingBuffer& StagingBuffer::operator=(StagingBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (data_ != nullptr)
+        {
+            StagingPool::instance().giveBack(data_, bytes_);
+        }
+        data_ = other.data_;
+        bytes_ = other.bytes_;
+        other.data_ = nullptr;
+        other.bytes_ = 0;
+    }
+    return *this;
+}
+
+StagingBuffer::~StagingBuffer()
+{
+    if (data_ != nullptr)
+    {
+        StagingPool::instance().giveBack(data_, bytes_);
+    }
+}
+
+StagingPool& StagingPool::instance()
+{
+    static StagingPool pool;
+    return pool;
+}
+
+StagingBuffer StagingPool::acquire(size_t bytes)
+{
+    // small transfers share the smallest bucket
+    const size_t capacity = std::bit_ceil(std::max(bytes, size_t {4096}));
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!finalizeHook_)
+    {
+        // page locked memory can not be freed after Kokkos is finalized
+        Kokkos::push_finalize_hook([]() { StagingPool::instance().finalize(); });
+        finalizeHook_ = true;
+    }
+    auto it = cached_.find(capacity);
+    if (it != cached_.end())
+    {
+        void* data = it->second;
+        cached_.erase(it);
+        stats_.nReuses++;
+        stats_.bytesCached -= capacity;
+        return StagingBuffer(data, capacity);
+    }
+    stats_.nAllocations++;
+    return StagingBuffer(Kokkos::kokkos_malloc<PinnedSpace>("NeoFOAM::staging", capacity), capacity);
+}
+
+void StagingPool::giveBack(void* data, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!finalizeHook_)
+    {
+        // Kokkos is finalized, the buffer can not be freed anymore
+        return;
+    }
+    cached_.emplace(bytes, data);
+    stats_.bytesCached += bytes;
+}
+
+void StagingPool::release()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [bytes, data] : cached_)
+    {
+        Kokkos::kokkos_free<PinnedSpace>(data);
+    }
+    cached_.clear();
+    stats_.bytesCached = 0;
+}
+
+void StagingPool::finalize()
+{
+    release();
+    std::lock_guard<std::mutex> lock(mutex_);
+    finalizeHook_ = false;
+}
+
+StagingPool::Stats StagingPool::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void StagingPool::resetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.nAllocations = 0;
+    stats_.nReuses = 0;
+}
+
+Kokkos::DefaultExecutionSpace transferSpace()
+{
+    static std::mutex mutex;
+    static std::optional<Kokkos::DefaultExecutionSpace> space;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!space)
+    {
+        space = Kokkos::Experimental::partition_space(Kokkos::DefaultExecutionSpace(), 1)[0];
+        // execution space instances have to be destroyed before Kokkos is finalized
+        Kokkos::push_finalize_hook([]() { space.reset(); });
+    }
+    return *space;
+}
+
+} // namespace NeoFOAM
@@ -0,0 +1,314 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#include <algorithm>
+#include <limits>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/error.hpp"
+#include "NeoFOAM/core/executor/threadPool.hpp"
+
+namespace NeoFOAM::detail
+{
+
+namespace
+{
+
+/* set while the thread processes chunks, loops launched then run on the calling worker */
+thread_local bool processing = false;
+
+/* the number of times an idle thread checks for the next loop before it sleeps */
+constexpr size_t spinCount = 1000;
+
+}
+
+WorkStealingDeque::Buffer::Buffer(size_t capacity)
+    : mask(capacity - 1), ranges(std::make_unique<std::atomic<ChunkRange>[]>(capacity))
+{}
+
+ChunkRange WorkStealingDeque::Buffer::load(int64_t i) const
+{
+    return ranges[static_cast<size_t>(i) & mask].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::store(int64_t i, ChunkRange range)
+{
+    ranges[static_cast<size_t>(i) & mask].store(range, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t capacity)
+{
+    NF_ASSERT(
+        capacity > 0 && (capacity & (capacity - 1)) == 0,
+        "capacity " << capacity << " is not a power of two"
+    );
+    buffers_.push_back(std::make_unique<Buffer>(capacity));
+    buffer_.store(buffers_.back().get(), std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::push(ChunkRange range)
+{
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(buffer->capacity()) - 1)
+    {
+        auto grown = std::make_unique<Buffer>(2 * buffer->capacity());
+        for (int64_t i = t; i < b; i++)
+        {
+            grown->store(i, buffer->load(i));
+        }
+        buffer = grown.get();
+        buffers_.push_back(std::move(grown));
+        buffer_.store(buffer, std::memory_order_release);
+    }
+    buffer->store(b, range);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+}
+
+std::optional<ChunkRange> WorkStealingDeque::pop()
+{
+    const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    if (t > b)
+    {
+        bottom_.store(b + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    ChunkRange range = buffer->load(b);
+    if (t == b)
+    {
+        // the last range, which a thief may take at the same time
+        const bool taken = !top_.compare_exchange_strong(
+            t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+        );
+        bottom_.store(b + 1, std::memory_order_relaxed);
+        if (taken)
+        {
+            return std::nullopt;
+        }
+    }
+    return range;
+}
+
+std::optional<ChunkRange> WorkStealingDeque::steal()
+{
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    if (t >= b)
+    {
+        return std::nullopt;
+    }
+    // the paper loads the buffer with memory_order_consume, which compilers promote to acquire
+    Buffer* buffer = buffer_.load(std::memory_order_acquire);
+    ChunkRange range = buffer->load(t);
+    if (!top_.compare_exchange_strong(
+            t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+        ))
+    {
+        return std::nullopt;
+    }
+    return range;
+}
+
+bool WorkStealingDeque::empty() const
+{
+    return bottom_.load(std::memory_order_relaxed) <= top_.load(std::memory_order_relaxed);
+}
+
+ThreadPool& ThreadPool::instance()
+{
+    static ThreadPool pool(
+        static_cast<size_t>(std::max(Kokkos::DefaultHostExecutionSpace().concurrency(), 1))
+    );
+    return pool;
+}
+
+ThreadPool::ThreadPool(size_t nThreads) { start(nThreads); }
+
+ThreadPool::~ThreadPool() { stop(); }
+
+void ThreadPool::resize(size_t nThreads)
+{
+    std::lock_guard<std::mutex> launch(launchMutex_);
+    stop();
+    start(nThreads);
+}
+
+void ThreadPool::start(size_t nThreads)
+{
+    NF_ASSERT(nThreads > 0, "A ThreadPool needs at least one thread");
+    stopping_ = false;
+    deques_.clear();
+    for (size_t worker = 0; worker < nThreads; worker++)
+    {
+        deques_.push_back(std::make_unique<WorkStealingDeque>());
+    }
+    // the calling thread is worker 0, the others wait for the loops launched from now on
+    const uint64_t generation = generation_.load(std::memory_order_relaxed);
+    for (size_t worker = 1; worker < nThreads; worker++)
+    {
+        threads_.emplace_back([this, worker, generation]() { work(worker, generation); });
+    }
+}
+
+void ThreadPool::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void ThreadPool::run(size_t nChunks, ChunkFunction function, const void* body)
+{
+    if (nChunks == 0)
+    {
+        return;
+    }
+    if (processing || size() == 1)
+    {
+        function(body, 0, nChunks, 0);
+        return;
+    }
+    NF_ASSERT(
+        nChunks <= std::numeric_limits<uint32_t>::max(),
+        "A loop on the ThreadPool can not have " << nChunks << " chunks"
+    );
+
+    std::lock_guard<std::mutex> launch(launchMutex_);
+    function_ = function;
+    body_ = body;
+    remaining_.store(nChunks, std::memory_order_relaxed);
+    // every thread starts on an equal share, which the others steal if it is late to wake up, the
+    // threads only access the deques after the release of the generation below
+    const size_t nWorkers = size();
+    for (size_t worker = 0; worker < nWorkers; worker++)
+    {
+        const auto first = static_cast<uint32_t>(nChunks * worker / nWorkers);
+        const auto last = static_cast<uint32_t>(nChunks * (worker + 1) / nWorkers);
+        if (first < last)
+        {
+            deques_[worker]->push({first, last});
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        nBusy_ = threads_.size();
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+    wake_.notify_all();
+
+    execute(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return nBusy_ == 0; });
+}
+
+void ThreadPool::work(size_t worker, uint64_t generation)
+{
+    while (true)
+    {
+        for (size_t spin = 0;
+             spin < spinCount && generation_.load(std::memory_order_acquire) == generation;
+             spin++)
+        {
+            std::this_thread::yield();
+        }
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(
+                lock,
+                [&]() {
+                    return stopping_ || generation_.load(std::memory_order_relaxed) != generation;
+                }
+            );
+            if (stopping_)
+            {
+                return;
+            }
+            generation = generation_.load(std::memory_order_relaxed);
+        }
+
+        execute(worker);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        nBusy_--;
+        if (nBusy_ == 0)
+        {
+            done_.notify_one();
+        }
+    }
+}
+
+void ThreadPool::execute(size_t worker)
+{
+    processing = true;
+    process(worker);
+
+    // steal from random victims until all chunks are processed
+    const size_t nWorkers = size();
+    uint64_t state = 0x9E3779B97F4A7C15ULL * (worker + 1);
+    size_t failed = 0;
+    while (remaining_.load(std::memory_order_acquire) > 0)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const auto victim = static_cast<size_t>(state % nWorkers);
+        if (victim == worker)
+        {
+            continue;
+        }
+        if (auto range = deques_[victim]->steal())
+        {
+            deques_[worker]->push(*range);
+            process(worker);
+            failed = 0;
+        }
+        else if (++failed >= nWorkers)
+        {
+            // the remaining chunks are being processed by other threads
+            std::this_thread::yield();
+            failed = 0;
+        }
+    }
+    processing = false;
+}
+
+void ThreadPool::process(size_t worker)
+{
+    WorkStealingDeque& deque = *deques_[worker];
+    while (auto range = deque.pop())
+    {
+        size_t nDone = 0;
+        while (range->begin < range->end)
+        {
+            // offer the upper half to idle threads once the previous offer was taken
+            if (range->end - range->begin > 1 && deque.empty())
+            {
+                const uint32_t mid = range->begin + (range->end - range->begin) / 2;
+                deque.push({mid, range->end});
+                range->end = mid;
+            }
+            function_(body_, range->begin, range->begin + 1, worker);
+            range->begin++;
+            nDone++;
+        }
+        remaining_.fetch_sub(nDone, std::memory_order_acq_rel);
+    }
+}
+
+} // namespace NeoFOAM::detail
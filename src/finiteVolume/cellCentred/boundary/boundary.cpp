@@ -2,3 +2,47 @@
 // SPDX-FileCopyrightText: 2024 NeoFOAM authors
 
 #include "NeoFOAM/finiteVolume/cellCentred/boundary.hpp"
+
+namespace NeoFOAM
+{
+
+namespace fvcc = finiteVolume::cellCentred;
+
+// instantiated for both precisions, independent of the precision selected for scalar
+template class fvcc::VolumeBoundaryFactory<float>;
+template class fvcc::VolumeBoundaryFactory<double>;
+template class fvcc::VolumeBoundaryFactory<Vector>;
+
+template class fvcc::volumeBoundary::FixedValue<float>;
+template class fvcc::volumeBoundary::FixedValue<double>;
+template class fvcc::volumeBoundary::FixedValue<Vector>;
+
+template class fvcc::volumeBoundary::FixedGradient<float>;
+template class fvcc::volumeBoundary::FixedGradient<double>;
+template class fvcc::volumeBoundary::FixedGradient<Vector>;
+
+template class fvcc::volumeBoundary::Calculated<float>;
+template class fvcc::volumeBoundary::Calculated<double>;
+template class fvcc::volumeBoundary::Calculated<Vector>;
+
+template class fvcc::volumeBoundary::Empty<float>;
+template class fvcc::volumeBoundary::Empty<double>;
+template class fvcc::volumeBoundary::Empty<Vector>;
+
+template class fvcc::SurfaceBoundaryFactory<float>;
+template class fvcc::SurfaceBoundaryFactory<double>;
+template class fvcc::SurfaceBoundaryFactory<Vector>;
+
+template class fvcc::surfaceBoundary::FixedValue<float>;
+template class fvcc::surfaceBoundary::FixedValue<double>;
+template class fvcc::surfaceBoundary::FixedValue<Vector>;
+
+template class fvcc::surfaceBoundary::Calculated<float>;
+template class fvcc::surfaceBoundary::Calculated<double>;
+template class fvcc::surfaceBoundary::Calculated<Vector>;
+
+template class fvcc::surfaceBoundary::Empty<float>;
+template class fvcc::surfaceBoundary::Empty<double>;
+template class fvcc::surfaceBoundary::Empty<Vector>;
+
+}
@@ -5,27 +5,28 @@
 
 #include "NeoFOAM/finiteVolume/cellCentred/interpolation/linear.hpp"
 #include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/profiling.hpp"
 
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+/* @brief the interpolation kernel, instantiated for each executor type and for the weights in full
+ * and reduced precision */
+template<typename ExecutorType, typename ValueType, typename WeightSpan>
 void computeLinearInterpolation(
-    const VolumeField<scalar>& volField,
-    const std::shared_ptr<GeometryScheme> geometryScheme,
-    SurfaceField<scalar>& surfaceField
+    const ExecutorType& exec,
+    const UnstructuredMesh& mesh,
+    std::span<const ValueType> sVolField,
+    std::span<const ValueType> sBField,
+    WeightSpan sWeight,
+    std::span<ValueType> sfield
 )
 {
-    const UnstructuredMesh& mesh = surfaceField.mesh();
-    const auto& exec = surfaceField.exec();
-    auto sfield = surfaceField.internalField().span();
-    const NeoFOAM::labelField& owner = mesh.faceOwner();
-    const NeoFOAM::labelField& neighbour = mesh.faceNeighbour();
-
-    const auto sWeight = geometryScheme->weights().internalField().span();
-    const auto sVolField = volField.internalField().span();
-    const auto sBField = volField.boundaryField().value().span();
-    const auto sOwner = owner.span();
-    const auto sNeighbour = neighbour.span();
+    const auto sOwner = mesh.faceOwner().span();
+    const auto sNeighbour = mesh.faceNeighbour().span();
     size_t nInternalFaces = mesh.nInternalFaces();
 
     NeoFOAM::parallelFor(
@@ -34,45 +35,87 @@ void computeLinearInterpolation(
         KOKKOS_LAMBDA(const size_t facei) {
             size_t own = static_cast<size_t>(sOwner[facei]);
             size_t nei = static_cast<size_t>(sNeighbour[facei]);
+            ValueType weight = static_cast<ValueType>(sWeight[facei]);
             if (facei < nInternalFaces)
             {
-                sfield[facei] =
-                    sWeight[facei] * sVolField[own] + (1 - sWeight[facei]) * sVolField[nei];
+                sfield[facei] = weight * sVolField[own] + (ValueType(1) - weight) * sVolField[nei];
             }
             else
             {
-                sfield[facei] = sWeight[facei] * sBField[facei - nInternalFaces];
+                sfield[facei] = weight * sBField[facei - nInternalFaces];
             }
+        },
+        "computeLinearInterpolation"
+    );
+}
+
+}
+
+template<typename ValueType>
+void computeLinearInterpolation(
+    const VolumeField<ValueType>& volField,
+    const std::shared_ptr<GeometryScheme> geometryScheme,
+    SurfaceField<ValueType>& surfaceField
+)
+{
+    Kokkos::Profiling::ScopedRegion region("NeoFOAM::computeLinearInterpolation");
+    NF_PROFILE_SCOPE("computeLinearInterpolation");
+    const UnstructuredMesh& mesh = surfaceField.mesh();
+    std::span<const ValueType> sVolField = volField.internalField().span();
+    std::span<const ValueType> sBField = volField.boundaryField().value().span();
+    auto sfield = surfaceField.internalField().span();
+
+    // the only dispatch on the executor, the kernel is compiled for the concrete type
+    geometryScheme->visitWeights(
+        [&](auto sWeight)
+        {
+            std::visit(
+                [&](const auto& e) {
+                    detail::computeLinearInterpolation(
+                        e, mesh, sVolField, sBField, sWeight, sfield
+                    );
+                },
+                surfaceField.exec()
+            );
         }
     );
 }
 
-Linear::Linear(const Executor& exec, const UnstructuredMesh& mesh, [[maybe_unused]] Input input)
-    : SurfaceInterpolationFactory::Register<Linear>(exec, mesh),
-      geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
+template<typename ValueType>
+Linear<ValueType>::Linear(
+    const Executor& exec, const UnstructuredMesh& mesh, [[maybe_unused]] Input input
+)
+    : Base(exec, mesh), geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
 
-Linear::Linear(const Executor& exec, const UnstructuredMesh& mesh)
-    : SurfaceInterpolationFactory::Register<Linear>(exec, mesh),
-      geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
+template<typename ValueType>
+Linear<ValueType>::Linear(const Executor& exec, const UnstructuredMesh& mesh)
+    : Base(exec, mesh), geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
 
-void Linear::interpolate(const VolumeField<scalar>& volField, SurfaceField<scalar>& surfaceField)
-    const
+template<typename ValueType>
+void Linear<ValueType>::interpolate(
+    const VolumeField<ValueType>& volField, SurfaceField<ValueType>& surfaceField
+) const
 {
     computeLinearInterpolation(volField, geometryScheme_, surfaceField);
 }
 
-void Linear::interpolate(
+template<typename ValueType>
+void Linear<ValueType>::interpolate(
     [[maybe_unused]] const SurfaceField<scalar>& faceFlux,
-    const VolumeField<scalar>& volField,
-    SurfaceField<scalar>& surfaceField
+    const VolumeField<ValueType>& volField,
+    SurfaceField<ValueType>& surfaceField
 ) const
 {
     interpolate(volField, surfaceField);
 }
 
-std::unique_ptr<SurfaceInterpolationFactory> Linear::clone() const
+template<typename ValueType>
+std::unique_ptr<SurfaceInterpolationFactory<ValueType>> Linear<ValueType>::clone() const
 {
     return std::make_unique<Linear>(*this);
 }
 
+template class Linear<float>;
+template class Linear<double>;
+
 } // namespace NeoFOAM
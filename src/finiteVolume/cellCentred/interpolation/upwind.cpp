@@ -5,29 +5,28 @@
 
 #include "NeoFOAM/finiteVolume/cellCentred/interpolation/upwind.hpp"
 #include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/profiling.hpp"
 
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+/* @brief the interpolation kernel, instantiated for each executor type */
+template<typename ExecutorType, typename ValueType>
 void computeUpwindInterpolation(
-    const SurfaceField<scalar>& faceFlux,
-    const VolumeField<scalar>& volField,
-    const std::shared_ptr<GeometryScheme> geometryScheme,
-    SurfaceField<scalar>& surfaceField
+    const ExecutorType& exec,
+    const UnstructuredMesh& mesh,
+    std::span<const scalar> sFaceFlux,
+    std::span<const ValueType> sVolField,
+    std::span<const ValueType> sBField,
+    std::span<const scalar> sWeight,
+    std::span<ValueType> sfield
 )
 {
-    const UnstructuredMesh& mesh = surfaceField.mesh();
-    const auto& exec = surfaceField.exec();
-
-    auto sfield = surfaceField.internalField().span();
-    const NeoFOAM::labelField& owner = mesh.faceOwner();
-    const NeoFOAM::labelField& neighbour = mesh.faceNeighbour();
-    const auto sWeight = geometryScheme->weights().internalField().span();
-    const auto sFaceFlux = faceFlux.internalField().span();
-    const auto sVolField = volField.internalField().span();
-    const auto sBField = volField.boundaryField().value().span();
-    const auto sOwner = owner.span();
-    const auto sNeighbour = neighbour.span();
+    const auto sOwner = mesh.faceOwner().span();
+    const auto sNeighbour = mesh.faceNeighbour().span();
     size_t nInternalFaces = mesh.nInternalFaces();
 
     NeoFOAM::parallelFor(
@@ -49,36 +48,76 @@ void computeUpwindInterpolation(
             }
             else
             {
-                sfield[facei] = sWeight[facei] * sBField[facei - nInternalFaces];
+                ValueType weight = static_cast<ValueType>(sWeight[facei]);
+                sfield[facei] = weight * sBField[facei - nInternalFaces];
             }
-        }
+        },
+        "computeUpwindInterpolation"
+    );
+}
+
+}
+
+template<typename ValueType>
+void computeUpwindInterpolation(
+    const SurfaceField<scalar>& faceFlux,
+    const VolumeField<ValueType>& volField,
+    const std::shared_ptr<GeometryScheme> geometryScheme,
+    SurfaceField<ValueType>& surfaceField
+)
+{
+    Kokkos::Profiling::ScopedRegion region("NeoFOAM::computeUpwindInterpolation");
+    NF_PROFILE_SCOPE("computeUpwindInterpolation");
+    const UnstructuredMesh& mesh = surfaceField.mesh();
+    std::span<const scalar> sWeight = geometryScheme->weights().internalField().span();
+    std::span<const scalar> sFaceFlux = faceFlux.internalField().span();
+    std::span<const ValueType> sVolField = volField.internalField().span();
+    std::span<const ValueType> sBField = volField.boundaryField().value().span();
+    auto sfield = surfaceField.internalField().span();
+
+    // the only dispatch on the executor, the kernel is compiled for the concrete type
+    std::visit(
+        [&](const auto& e) {
+            detail::computeUpwindInterpolation(
+                e, mesh, sFaceFlux, sVolField, sBField, sWeight, sfield
+            );
+        },
+        surfaceField.exec()
     );
 }
 
-Upwind::Upwind(const Executor& exec, const UnstructuredMesh& mesh, [[maybe_unused]] Input input)
-    : SurfaceInterpolationFactory::Register<Upwind>(exec, mesh),
-      geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
+template<typename ValueType>
+Upwind<ValueType>::Upwind(
+    const Executor& exec, const UnstructuredMesh& mesh, [[maybe_unused]] Input input
+)
+    : Base(exec, mesh), geometryScheme_(GeometryScheme::readOrCreate(mesh)) {};
 
-void Upwind::interpolate(
-    [[maybe_unused]] const VolumeField<scalar>& volField,
-    [[maybe_unused]] SurfaceField<scalar>& surfaceField
+template<typename ValueType>
+void Upwind<ValueType>::interpolate(
+    [[maybe_unused]] const VolumeField<ValueType>& volField,
+    [[maybe_unused]] SurfaceField<ValueType>& surfaceField
 ) const
 {
     NF_ERROR_EXIT("limited scheme require a faceFlux");
 }
 
-void Upwind::interpolate(
+template<typename ValueType>
+void Upwind<ValueType>::interpolate(
     const SurfaceField<scalar>& faceFlux,
-    const VolumeField<scalar>& volField,
-    SurfaceField<scalar>& surfaceField
+    const VolumeField<ValueType>& volField,
+    SurfaceField<ValueType>& surfaceField
 ) const
 {
     computeUpwindInterpolation(faceFlux, volField, geometryScheme_, surfaceField);
 }
 
-std::unique_ptr<SurfaceInterpolationFactory> Upwind::clone() const
+template<typename ValueType>
+std::unique_ptr<SurfaceInterpolationFactory<ValueType>> Upwind<ValueType>::clone() const
 {
     return std::make_unique<Upwind>(*this);
 }
 
+template class Upwind<float>;
+template class Upwind<double>;
+
 } // namespace NeoFOAM
@@ -2,135 +2,156 @@
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 
 #include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenDiv.hpp"
 
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+/* @brief divide by the cell volumes, instantiated for the volumes in full and reduced precision */
+template<typename ExecutorType, typename ValueType, typename VolumeSpan>
+void scaleByVolume(const ExecutorType& exec, std::span<ValueType> divPhi, VolumeSpan V)
+{
+    parallelFor(
+        exec,
+        {0, divPhi.size()},
+        KOKKOS_LAMBDA(const size_t celli) {
+            divPhi[celli] *= static_cast<ValueType>(1 / V[celli]);
+        },
+        "computeDiv::scaleByVolume"
+    );
+}
 
+/* @brief sum the face fluxes into the cells, instantiated for each executor and value type */
+template<typename ExecutorType, typename ValueType>
+void computeDiv(
+    const ExecutorType& exec,
+    const UnstructuredMesh& mesh,
+    std::span<const scalar> surfFaceFlux,
+    std::span<const ValueType> surfPhif,
+    std::span<ValueType> surfDivPhi
+)
+{
+    const auto surfFaceCells = mesh.boundaryMesh().faceCells().span();
+    const auto surfOwner = mesh.faceOwner().span();
+    const auto surfNeighbour = mesh.faceNeighbour().span();
+    size_t nInternalFaces = mesh.nInternalFaces();
+
+    parallelFor(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t i) {
+            ValueType flux = static_cast<ValueType>(surfFaceFlux[i]) * surfPhif[i];
+            scatterAdd<ExecutorType>(surfDivPhi[static_cast<size_t>(surfOwner[i])], flux);
+            scatterSub<ExecutorType>(surfDivPhi[static_cast<size_t>(surfNeighbour[i])], flux);
+        },
+        "computeDiv::internalFaces"
+    );
+
+    parallelFor(
+        exec,
+        {nInternalFaces, surfPhif.size()},
+        KOKKOS_LAMBDA(const size_t i) {
+            auto own = static_cast<size_t>(surfFaceCells[i - nInternalFaces]);
+            ValueType valueOwn = static_cast<ValueType>(surfFaceFlux[i]) * surfPhif[i];
+            scatterAdd<ExecutorType>(surfDivPhi[own], valueOwn);
+        },
+        "computeDiv::boundaryFaces"
+    );
+
+    mesh.visitCellVolumes([&](auto surfV)
+                          { scaleByVolume(exec, surfDivPhi.first(mesh.nCells()), surfV); });
+}
+
+}
+
+template<typename ValueType>
 void computeDiv(
     const SurfaceField<scalar>& faceFlux,
-    const VolumeField<scalar>& phi,
-    const SurfaceInterpolation& surfInterp,
-    Field<scalar>& divPhi
+    const VolumeField<ValueType>& phi,
+    const SurfaceInterpolation<ValueType>& surfInterp,
+    Field<ValueType>& divPhi
 )
 {
+    Kokkos::Profiling::ScopedRegion region("NeoFOAM::computeDiv");
+    NF_PROFILE_SCOPE("computeDiv");
     const UnstructuredMesh& mesh = phi.mesh();
     const auto exec = phi.exec();
-    SurfaceField<scalar> phif(
-        exec, "phif", mesh, createCalculatedBCs<SurfaceBoundary<scalar>>(mesh)
+    SurfaceField<ValueType> phif(
+        exec, "phif", mesh, createCalculatedBCs<SurfaceBoundary<ValueType>>(mesh)
     );
-    fill(phif.internalField(), 0.0);
-    const auto surfFaceCells = mesh.boundaryMesh().faceCells().span();
+    fill(phif.internalField(), ValueType(0));
     surfInterp.interpolate(faceFlux, phi, phif);
 
+    std::span<const ValueType> surfPhif = phif.internalField().span();
+    std::span<const scalar> surfFaceFlux = faceFlux.internalField().span();
     auto surfDivPhi = divPhi.span();
 
-    const auto surfPhif = phif.internalField().span();
-    const auto surfOwner = mesh.faceOwner().span();
-    const auto surfNeighbour = mesh.faceNeighbour().span();
-    const auto surfFaceFlux = faceFlux.internalField().span();
-    size_t nInternalFaces = mesh.nInternalFaces();
-    const auto surfV = mesh.cellVolumes().span();
-
-    // check if the executor is GPU
-    if (std::holds_alternative<SerialExecutor>(exec))
-    {
-        for (size_t i = 0; i < nInternalFaces; i++)
-        {
-            scalar flux = surfFaceFlux[i] * surfPhif[i];
-            surfDivPhi[static_cast<size_t>(surfOwner[i])] += flux;
-            surfDivPhi[static_cast<size_t>(surfNeighbour[i])] -= flux;
-        }
-
-        for (size_t i = nInternalFaces; i < surfPhif.size(); i++)
-        {
-            auto own = static_cast<size_t>(surfFaceCells[i - nInternalFaces]);
-            scalar valueOwn = surfFaceFlux[i] * surfPhif[i];
-            surfDivPhi[own] += valueOwn;
-        }
-
-        for (size_t celli = 0; celli < mesh.nCells(); celli++)
-        {
-            surfDivPhi[celli] *= 1 / surfV[celli];
-        }
-    }
-    else
-    {
-        parallelFor(
-            exec,
-            {0, nInternalFaces},
-            KOKKOS_LAMBDA(const size_t i) {
-                scalar flux = surfFaceFlux[i] * surfPhif[i];
-                Kokkos::atomic_add(&surfDivPhi[static_cast<size_t>(surfOwner[i])], flux);
-                Kokkos::atomic_sub(&surfDivPhi[static_cast<size_t>(surfNeighbour[i])], flux);
-            }
-        );
-
-        parallelFor(
-            exec,
-            {nInternalFaces, surfPhif.size()},
-            KOKKOS_LAMBDA(const size_t i) {
-                auto own = static_cast<size_t>(surfFaceCells[i - nInternalFaces]);
-                scalar valueOwn = surfFaceFlux[i] * surfPhif[i];
-                Kokkos::atomic_add(&surfDivPhi[own], valueOwn);
-            }
-        );
-
-        parallelFor(
-            exec,
-            {0, mesh.nCells()},
-            KOKKOS_LAMBDA(const size_t celli) { surfDivPhi[celli] *= 1 / surfV[celli]; }
-        );
-    }
+    // the only dispatch on the executor, the kernels are compiled for the concrete type
+    std::visit(
+        [&](const auto& e) { detail::computeDiv(e, mesh, surfFaceFlux, surfPhif, surfDivPhi); },
+        exec
+    );
 }
 
+template<typename ValueType>
 void computeDiv(
     const SurfaceField<scalar>& faceFlux,
-    const VolumeField<scalar>& phi,
-    const SurfaceInterpolation& surfInterp,
-    VolumeField<scalar>& divPhi
+    const VolumeField<ValueType>& phi,
+    const SurfaceInterpolation<ValueType>& surfInterp,
+    VolumeField<ValueType>& divPhi
 )
 {
-    Field<scalar>& divPhiField = divPhi.internalField();
+    Field<ValueType>& divPhiField = divPhi.internalField();
     computeDiv(faceFlux, phi, surfInterp, divPhiField);
 }
 
-GaussGreenDiv::GaussGreenDiv(
+template<typename ValueType>
+GaussGreenDiv<ValueType>::GaussGreenDiv(
     const Executor& exec, const UnstructuredMesh& mesh, const Input& inputs
 )
-    : DivOperatorFactory::Register<GaussGreenDiv>(exec, mesh),
-      surfaceInterpolation_(exec, mesh, inputs) {};
+    : Base(exec, mesh), surfaceInterpolation_(exec, mesh, inputs) {};
 
-void GaussGreenDiv::div(
-    VolumeField<scalar>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi
+template<typename ValueType>
+void GaussGreenDiv<ValueType>::div(
+    VolumeField<ValueType>& divPhi,
+    const SurfaceField<scalar>& faceFlux,
+    VolumeField<ValueType>& phi
 )
 {
     computeDiv(faceFlux, phi, surfaceInterpolation_, divPhi);
 };
 
-void GaussGreenDiv::div(
-    Field<scalar>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi
+template<typename ValueType>
+void GaussGreenDiv<ValueType>::div(
+    Field<ValueType>& divPhi, const SurfaceField<scalar>& faceFlux, VolumeField<ValueType>& phi
 )
 {
     computeDiv(faceFlux, phi, surfaceInterpolation_, divPhi);
 };
 
-VolumeField<scalar>
-GaussGreenDiv::div(const SurfaceField<scalar>& faceFlux, VolumeField<scalar>& phi)
+template<typename ValueType>
+VolumeField<ValueType>
+GaussGreenDiv<ValueType>::div(const SurfaceField<scalar>& faceFlux, VolumeField<ValueType>& phi)
 {
     std::string name = "div(" + faceFlux.name + "," + phi.name + ")";
-    VolumeField<scalar> divPhi(
-        exec_, name, mesh_, createCalculatedBCs<VolumeBoundary<scalar>>(mesh_)
+    VolumeField<ValueType> divPhi(
+        this->exec_, name, this->mesh_, createCalculatedBCs<VolumeBoundary<ValueType>>(this->mesh_)
     );
     computeDiv(faceFlux, phi, surfaceInterpolation_, divPhi);
     return divPhi;
 };
 
-std::unique_ptr<DivOperatorFactory> GaussGreenDiv::clone() const
+template<typename ValueType>
+std::unique_ptr<DivOperatorFactory<ValueType>> GaussGreenDiv<ValueType>::clone() const
 {
     return std::make_unique<GaussGreenDiv>(*this);
 }
 
+template class GaussGreenDiv<float>;
+template class GaussGreenDiv<double>;
 
 };
@@ -4,88 +4,116 @@
 #include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
 #include "NeoFOAM/finiteVolume/cellCentred/interpolation/linear.hpp"
 #include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/primitives/batch.hpp"
+#include "NeoFOAM/core/profiling.hpp"
 
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
+namespace detail
+{
+
+/* @brief sum the face contributions into the cells, instantiated for each executor type */
+template<typename ExecutorType>
 void computeGrad(
-    const VolumeField<scalar>& phi,
-    const SurfaceInterpolation& surfInterp,
-    VolumeField<Vector>& gradPhi
+    const ExecutorType& exec,
+    const UnstructuredMesh& mesh,
+    std::span<const scalar> surfPhif,
+    std::span<Vector> surfGradPhi
 )
 {
-    const UnstructuredMesh& mesh = gradPhi.mesh();
-    const auto exec = gradPhi.exec();
-    SurfaceField<scalar> phif(
-        exec, "phif", mesh, createCalculatedBCs<SurfaceBoundary<scalar>>(mesh)
-    );
+    constexpr size_t width = batchWidth<ExecutorType>();
     const auto surfFaceCells = mesh.boundaryMesh().faceCells().span();
     const auto sBSf = mesh.boundaryMesh().sf().span();
-    auto surfGradPhi = gradPhi.internalField().span();
-
-    surfInterp.interpolate(phi, phif);
-    const auto surfPhif = phif.internalField().span();
     const auto surfOwner = mesh.faceOwner().span();
     const auto surfNeighbour = mesh.faceNeighbour().span();
     const auto sSf = mesh.faceAreas().span();
-    size_t nInternalFaces = mesh.nInternalFaces();
-
     const auto surfV = mesh.cellVolumes().span();
+    size_t nInternalFaces = mesh.nInternalFaces();
 
-    if (std::holds_alternative<SerialExecutor>(exec))
-    {
-        for (size_t i = 0; i < nInternalFaces; i++)
-        {
+    parallelForBatches<width>(
+        exec,
+        {0, nInternalFaces},
+        KOKKOS_LAMBDA(const size_t first) {
+            const auto flux =
+                VectorBatch<width>::load(sSf, first) * ScalarBatch<width>::load(surfPhif, first);
+            // neighbouring faces may share cells, so only the fluxes are computed lane wise
+            for (size_t l = 0; l < width; l++)
+            {
+                const Vector fluxl = flux[l];
+                scatterAdd<ExecutorType>(
+                    surfGradPhi[static_cast<size_t>(surfOwner[first + l])], fluxl
+                );
+                scatterSub<ExecutorType>(
+                    surfGradPhi[static_cast<size_t>(surfNeighbour[first + l])], fluxl
+                );
+            }
+        },
+        KOKKOS_LAMBDA(const size_t i) {
             Vector flux = sSf[i] * surfPhif[i];
-            surfGradPhi[static_cast<size_t>(surfOwner[i])] += flux;
-            surfGradPhi[static_cast<size_t>(surfNeighbour[i])] -= flux;
-        }
+            scatterAdd<ExecutorType>(surfGradPhi[static_cast<size_t>(surfOwner[i])], flux);
+            scatterSub<ExecutorType>(surfGradPhi[static_cast<size_t>(surfNeighbour[i])], flux);
+        },
+        "computeGrad::internalFaces"
+    );
 
-        for (size_t i = nInternalFaces; i < surfPhif.size(); i++)
-        {
+    parallelFor(
+        exec,
+        {nInternalFaces, surfPhif.size()},
+        KOKKOS_LAMBDA(const size_t i) {
             size_t own = static_cast<size_t>(surfFaceCells[i - nInternalFaces]);
             Vector valueOwn = sBSf[i - nInternalFaces] * surfPhif[i];
-            surfGradPhi[own] += valueOwn;
-        }
+            scatterAdd<ExecutorType>(surfGradPhi[own], valueOwn);
+        },
+        "computeGrad::boundaryFaces"
+    );
 
-        for (size_t celli = 0; celli < mesh.nCells(); celli++)
-        {
-            surfGradPhi[celli] *= 1 / surfV[celli];
-        }
-    }
-    else
-    {
-        parallelFor(
-            exec,
-            {0, nInternalFaces},
-            KOKKOS_LAMBDA(const size_t i) {
-                Vector flux = sSf[i] * surfPhif[i];
-                Kokkos::atomic_add(&surfGradPhi[static_cast<size_t>(surfOwner[i])], flux);
-                Kokkos::atomic_sub(&surfGradPhi[static_cast<size_t>(surfNeighbour[i])], flux);
+    parallelForBatches<width>(
+        exec,
+        {0, mesh.nCells()},
+        KOKKOS_LAMBDA(const size_t first) {
+            ScalarBatch<width> rV;
+            for (size_t l = 0; l < width; l++)
+            {
+                rV[l] = 1 / surfV[first + l];
             }
-        );
+            (VectorBatch<width>::load(surfGradPhi, first) * rV).store(surfGradPhi, first);
+        },
+        KOKKOS_LAMBDA(const size_t celli) { surfGradPhi[celli] *= 1 / surfV[celli]; },
+        "computeGrad::scaleByVolume"
+    );
+}
 
-        parallelFor(
-            exec,
-            {nInternalFaces, surfPhif.size()},
-            KOKKOS_LAMBDA(const size_t i) {
-                size_t own = static_cast<size_t>(surfFaceCells[i - nInternalFaces]);
-                Vector valueOwn = sSf[i] * surfPhif[i];
-                Kokkos::atomic_add(&surfGradPhi[own], valueOwn);
-            }
-        );
+}
 
-        parallelFor(
-            exec,
-            {0, mesh.nCells()},
-            KOKKOS_LAMBDA(const size_t celli) { surfGradPhi[celli] *= 1 / surfV[celli]; }
-        );
-    }
+void computeGrad(
+    const VolumeField<scalar>& phi,
+    const SurfaceInterpolation<scalar>& surfInterp,
+    VolumeField<Vector>& gradPhi
+)
+{
+    Kokkos::Profiling::ScopedRegion region("NeoFOAM::computeGrad");
+    NF_PROFILE_SCOPE("computeGrad");
+    const UnstructuredMesh& mesh = gradPhi.mesh();
+    const auto exec = gradPhi.exec();
+    SurfaceField<scalar> phif(
+        exec, "phif", mesh, createCalculatedBCs<SurfaceBoundary<scalar>>(mesh)
+    );
+    surfInterp.interpolate(phi, phif);
+
+    const auto surfPhif = phif.internalField().span();
+    auto surfGradPhi = gradPhi.internalField().span();
+
+    // the only dispatch on the executor, the kernels are compiled for the concrete type
+    std::visit(
+        [&](const auto& e) { detail::computeGrad(e, mesh, surfPhif, surfGradPhi); }, exec
+    );
 }
 
 GaussGreenGrad::GaussGreenGrad(const Executor& exec, const UnstructuredMesh& mesh)
-    : mesh_(mesh),
-      surfaceInterpolation_(exec, mesh, std::make_unique<Linear>(exec, mesh, Dictionary())) {};
+    : mesh_(mesh), surfaceInterpolation_(
+                       exec, mesh, std::make_unique<Linear<scalar>>(exec, mesh, Dictionary())
+                   ) {};
 
 
 void GaussGreenGrad::grad(const VolumeField<scalar>& phi, VolumeField<Vector>& gradPhi)
@@ -2,28 +2,43 @@
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 
 #include "NeoFOAM/finiteVolume/cellCentred/stencil/basicGeometryScheme.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/primitives/batch.hpp"
 
 namespace NeoFOAM::finiteVolume::cellCentred
 {
 
-BasicGeometryScheme::BasicGeometryScheme(const UnstructuredMesh& mesh)
-    : GeometrySchemeFactory(mesh), mesh_(mesh)
-{}
+namespace detail
+{
 
-void BasicGeometryScheme::updateWeights(const Executor& exec, SurfaceField<scalar>& weights)
+/* @brief compute the linear interpolation weights, instantiated for each executor type */
+template<typename ExecutorType>
+void updateWeights(const ExecutorType& exec, const UnstructuredMesh& mesh, std::span<scalar> w)
 {
-    const auto owner = mesh_.faceOwner().span();
-    const auto neighbour = mesh_.faceNeighbour().span();
+    constexpr size_t width = batchWidth<ExecutorType>();
+    const auto owner = mesh.faceOwner().span();
+    const auto neighbour = mesh.faceNeighbour().span();
 
-    const auto cf = mesh_.faceCentres().span();
-    const auto c = mesh_.cellCentres().span();
-    const auto sf = mesh_.faceAreas().span();
+    const auto cf = mesh.faceCentres().span();
+    const auto c = mesh.cellCentres().span();
+    const auto sf = mesh.faceAreas().span();
 
-    auto w = weights.internalField().span();
-
-    parallelFor(
+    parallelForBatches<width>(
         exec,
-        {0, mesh_.nInternalFaces()},
+        {0, mesh.nInternalFaces()},
+        KOKKOS_LAMBDA(const size_t first) {
+            const auto sfBatch = VectorBatch<width>::load(sf, first);
+            const auto cfBatch = VectorBatch<width>::load(cf, first);
+            const auto cOwn = VectorBatch<width>::gather(c, owner, first);
+            const auto cNei = VectorBatch<width>::gather(c, neighbour, first);
+            const auto sfdOwn = mag(sfBatch & (cfBatch - cOwn));
+            const auto sfdNei = mag(sfBatch & (cNei - cfBatch));
+            for (size_t l = 0; l < width; l++)
+            {
+                const scalar sum = sfdOwn[l] + sfdNei[l];
+                w[first + l] = std::abs(sum) > ROOTVSMALL ? sfdNei[l] / sum : 0.5;
+            }
+        },
         KOKKOS_LAMBDA(const size_t facei) {
             // Note: mag in the dot-product.
             // For all valid meshes, the non-orthogonality will be less than
@@ -41,16 +56,31 @@ void BasicGeometryScheme::updateWeights(const Executor& exec, SurfaceField<scala
             {
                 w[facei] = 0.5;
             }
-        }
+        },
+        "BasicGeometryScheme::updateWeights::internalFaces"
     );
 
     parallelFor(
         exec,
-        {mesh_.nInternalFaces(), w.size()},
-        KOKKOS_LAMBDA(const size_t facei) { w[facei] = 1.0; }
+        {mesh.nInternalFaces(), w.size()},
+        KOKKOS_LAMBDA(const size_t facei) { w[facei] = 1.0; },
+        "BasicGeometryScheme::updateWeights::boundaryFaces"
     );
 }
 
+}
+
+BasicGeometryScheme::BasicGeometryScheme(const UnstructuredMesh& mesh)
+    : GeometrySchemeFactory(mesh), mesh_(mesh)
+{}
+
+void BasicGeometryScheme::updateWeights(const Executor& exec, SurfaceField<scalar>& weights)
+{
+    auto w = weights.internalField().span();
+    // dispatch once, the batch width depends on the executor type
+    std::visit([&](const auto& e) { detail::updateWeights(e, mesh_, w); }, exec);
+}
+
 void BasicGeometryScheme::updateDeltaCoeffs(
     [[maybe_unused]] const Executor& exec, [[maybe_unused]] SurfaceField<scalar>& deltaCoeffs
 )
@@ -113,6 +113,27 @@ void GeometryScheme::update()
         },
         exec_
     );
+    if (reducedWeights_)
+    {
+        reducedWeights_.emplace(convert<ReducedType<scalar>>(weights_.internalField()));
+    }
+}
+
+void GeometryScheme::setWeightsPrecision(Precision precision)
+{
+    if (precision == Precision::reduced)
+    {
+        reducedWeights_.emplace(convert<ReducedType<scalar>>(weights_.internalField()));
+    }
+    else
+    {
+        reducedWeights_.reset();
+    }
+}
+
+Precision GeometryScheme::weightsPrecision() const
+{
+    return reducedWeights_ ? Precision::reduced : Precision::full;
 }
 
 const SurfaceField<scalar>& GeometryScheme::weights() const { return weights_; }
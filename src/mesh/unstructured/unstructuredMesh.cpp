@@ -3,6 +3,10 @@
 
 #include "NeoFOAM/mesh/unstructured/unstructuredMesh.hpp"
 
+#include <array>
+#include <vector>
+
+#include "NeoFOAM/core/error.hpp"
 #include "NeoFOAM/core/primitives/vector.hpp" // for Vector
 
 
@@ -49,6 +53,37 @@ const labelField& UnstructuredMesh::faceOwner() const { return faceOwner_; }
 
 const labelField& UnstructuredMesh::faceNeighbour() const { return faceNeighbour_; }
 
+void UnstructuredMesh::setPrecision(GeometryArray array, Precision precision)
+{
+    auto select = [&](const scalarField& values, std::optional<Field<ReducedType<scalar>>>& reduced)
+    {
+        if (precision == Precision::reduced)
+        {
+            reduced.emplace(convert<ReducedType<scalar>>(values));
+        }
+        else
+        {
+            reduced.reset();
+        }
+    };
+    switch (array)
+    {
+    case GeometryArray::cellVolumes:
+        select(cellVolumes_, reducedCellVolumes_);
+        break;
+    case GeometryArray::magFaceAreas:
+        select(magFaceAreas_, reducedMagFaceAreas_);
+        break;
+    }
+}
+
+Precision UnstructuredMesh::precision(GeometryArray array) const
+{
+    const auto& reduced =
+        array == GeometryArray::cellVolumes ? reducedCellVolumes_ : reducedMagFaceAreas_;
+    return reduced ? Precision::reduced : Precision::full;
+}
+
 size_t UnstructuredMesh::nCells() const { return nCells_; }
 
 size_t UnstructuredMesh::nInternalFaces() const { return nInternalFaces_; }
@@ -128,7 +163,8 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const size_t nCells)
         {0, nCells - 1},
         KOKKOS_LAMBDA(const size_t i) {
             meshPointsSpan[i][0] = leftBoundaryX + static_cast<scalar>(i + 1) * meshSpacing;
-        }
+        },
+        "create1DUniformMesh::points"
     );
 
     scalarField cellVolumes(exec, nCells, meshSpacing);
@@ -140,7 +176,8 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const size_t nCells)
         {0, nCells},
         KOKKOS_LAMBDA(const size_t i) {
             cellCentersSpan[i][0] = 0.5 * meshSpacing + meshSpacing * static_cast<scalar>(i);
-        }
+        },
+        "create1DUniformMesh::cellCentres"
     );
 
 
@@ -166,7 +203,8 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const size_t nCells)
         KOKKOS_LAMBDA(const size_t i) {
             faceOwnerSpan[i] = static_cast<label>(i);
             faceNeighborSpan[i] = static_cast<label>(i + 1);
-        }
+        },
+        "create1DUniformMesh::faceCells"
     );
 
     vectorField deltaHost(hostExec, 2);
@@ -211,4 +249,170 @@ UnstructuredMesh create1DUniformMesh(const Executor exec, const size_t nCells)
         boundaryMesh
     );
 }
+
+UnstructuredMesh
+create3DUniformMesh(const Executor exec, const size_t nx, const size_t ny, const size_t nz)
+{
+    NF_ASSERT(nx > 0 && ny > 0 && nz > 0, "A 3D mesh requires at least one cell per direction.");
+    const std::array<size_t, 3> n {nx, ny, nz};
+    const Vector spacing {
+        1.0 / static_cast<scalar>(nx), 1.0 / static_cast<scalar>(ny), 1.0 / static_cast<scalar>(nz)
+    };
+    const std::array<Vector, 3> unit {Vector(1, 0, 0), Vector(0, 1, 0), Vector(0, 0, 1)};
+    const Vector faceArea {
+        spacing[1] * spacing[2], spacing[0] * spacing[2], spacing[0] * spacing[1]
+    };
+    const size_t nCells = nx * ny * nz;
+
+    // the mesh is assembled on the host and copied to the executor afterwards
+    auto cellIndex = [&](const std::array<size_t, 3>& c)
+    { return static_cast<label>(c[0] + nx * (c[1] + ny * c[2])); };
+    auto cellCentre = [&](const std::array<size_t, 3>& c)
+    {
+        return Vector(
+            (static_cast<scalar>(c[0]) + 0.5) * spacing[0],
+            (static_cast<scalar>(c[1]) + 0.5) * spacing[1],
+            (static_cast<scalar>(c[2]) + 0.5) * spacing[2]
+        );
+    };
+    auto forAllCells = [&](auto func)
+    {
+        for (size_t k = 0; k < nz; k++)
+        {
+            for (size_t j = 0; j < ny; j++)
+            {
+                for (size_t i = 0; i < nx; i++)
+                {
+                    func(std::array<size_t, 3> {i, j, k});
+                }
+            }
+        }
+    };
+
+    std::vector<Vector> points;
+    points.reserve((nx + 1) * (ny + 1) * (nz + 1));
+    for (size_t k = 0; k <= nz; k++)
+    {
+        for (size_t j = 0; j <= ny; j++)
+        {
+            for (size_t i = 0; i <= nx; i++)
+            {
+                points.emplace_back(
+                    static_cast<scalar>(i) * spacing[0],
+                    static_cast<scalar>(j) * spacing[1],
+                    static_cast<scalar>(k) * spacing[2]
+                );
+            }
+        }
+    }
+
+    std::vector<Vector> cellCentres;
+    cellCentres.reserve(nCells);
+    forAllCells([&](const auto& c) { cellCentres.push_back(cellCentre(c)); });
+
+    std::vector<Vector> faceAreas;
+    std::vector<Vector> faceCentres;
+    std::vector<scalar> magFaceAreas;
+    std::vector<label> faceOwner;
+    std::vector<label> faceNeighbour;
+
+    // internal faces point from the owner to the neighbour with the larger index
+    for (size_t dir = 0; dir < 3; dir++)
+    {
+        forAllCells(
+            [&](const auto& c)
+            {
+                if (c[dir] + 1 == n[dir])
+                {
+                    return;
+                }
+                auto neighbour = c;
+                neighbour[dir]++;
+                faceAreas.push_back(faceArea[dir] * unit[dir]);
+                faceCentres.push_back(cellCentre(c) + 0.5 * spacing[dir] * unit[dir]);
+                magFaceAreas.push_back(faceArea[dir]);
+                faceOwner.push_back(cellIndex(c));
+                faceNeighbour.push_back(cellIndex(neighbour));
+            }
+        );
+    }
+    const size_t nInternalFaces = faceNeighbour.size();
+
+    std::vector<label> faceCells;
+    std::vector<Vector> cf;
+    std::vector<Vector> cn;
+    std::vector<Vector> sf;
+    std::vector<scalar> magSf;
+    std::vector<Vector> nf;
+    std::vector<Vector> delta;
+    std::vector<scalar> deltaCoeffs;
+    std::vector<localIdx> offset {0};
+    for (size_t dir = 0; dir < 3; dir++)
+    {
+        for (size_t side = 0; side < 2; side++)
+        {
+            const scalar sign = side == 0 ? -1.0 : 1.0;
+            const size_t layer = side == 0 ? 0 : n[dir] - 1;
+            forAllCells(
+                [&](const auto& c)
+                {
+                    if (c[dir] != layer)
+                    {
+                        return;
+                    }
+                    const Vector normal = sign * unit[dir];
+                    const Vector centre = cellCentre(c) + 0.5 * spacing[dir] * normal;
+                    faceCells.push_back(cellIndex(c));
+                    cf.push_back(centre);
+                    cn.push_back(cellCentre(c));
+                    sf.push_back(faceArea[dir] * normal);
+                    magSf.push_back(faceArea[dir]);
+                    nf.push_back(normal);
+                    delta.push_back(0.5 * spacing[dir] * normal);
+                    deltaCoeffs.push_back(2.0 / spacing[dir]);
+                }
+            );
+            offset.push_back(faceCells.size());
+        }
+    }
+    const size_t nBoundaryFaces = faceCells.size();
+
+    // the owners and geometry of the boundary faces follow those of the internal faces
+    faceOwner.insert(faceOwner.end(), faceCells.begin(), faceCells.end());
+    faceAreas.insert(faceAreas.end(), sf.begin(), sf.end());
+    faceCentres.insert(faceCentres.end(), cf.begin(), cf.end());
+    magFaceAreas.insert(magFaceAreas.end(), magSf.begin(), magSf.end());
+
+    BoundaryMesh boundaryMesh(
+        exec,
+        {exec, faceCells},
+        {exec, cf},
+        {exec, cn},
+        {exec, sf},
+        {exec, magSf},
+        {exec, nf},
+        {exec, delta},
+        {exec, nBoundaryFaces, 1.0},
+        {exec, deltaCoeffs},
+        offset
+    );
+
+    return UnstructuredMesh(
+        {exec, points},
+        {exec, nCells, spacing[0] * spacing[1] * spacing[2]},
+        {exec, cellCentres},
+        {exec, faceAreas},
+        {exec, faceCentres},
+        {exec, magFaceAreas},
+        {exec, faceOwner},
+        {exec, faceNeighbour},
+        nCells,
+        nInternalFaces,
+        nBoundaryFaces,
+        6,
+        nInternalFaces + nBoundaryFaces,
+        boundaryMesh
+    );
+}
+
 } // namespace NeoFOAM
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2023 NeoFOAM authors
 
+#include "NeoFOAM/core/profiling.hpp"
 #include "NeoFOAM/timeIntegration/rungeKutta.hpp"
 
 namespace NeoFOAM::timeIntegration
@@ -10,8 +11,7 @@ template<typename SolutionFieldType>
 RungeKutta<SolutionFieldType>::RungeKutta(const RungeKutta<SolutionFieldType>& other)
     : Base(other), solution_(other.solution_), initialConditions_(other.initialConditions_),
       pdeExpr_(
-          other.pdeExpr_ ? std::make_unique<NeoFOAM::dsl::Expression>(other.pdeExpr_->exec())
-                         : nullptr
+          other.pdeExpr_ ? std::make_unique<Expression>(other.pdeExpr_->exec()) : nullptr
       )
 {
     sunrealtype timeCurrent;
@@ -32,6 +32,8 @@ void RungeKutta<SolutionFieldType>::solve(
     Expression& exp, SolutionFieldType& solutionField, scalar t, const scalar dt
 )
 {
+    Kokkos::Profiling::ScopedRegion region("NeoFOAM::RungeKutta::solve");
+    NF_PROFILE_SCOPE("rungeKutta");
     // Setup sundials if required, load the current solution for temporal integration
     SolutionFieldType& oldSolutionField =
         NeoFOAM::finiteVolume::cellCentred::oldTime(solutionField);
@@ -138,5 +140,7 @@ void RungeKutta<SolutionFieldType>::initODEMemory(const scalar t)
     ARKodeSStolerances(ODEMemory_.get(), 1.0, 1.0); // If we want ARK we will revisit.
 }
 
-template class RungeKutta<finiteVolume::cellCentred::VolumeField<scalar>>;
+// instantiated for both precisions, the stages are computed in the precision of sunrealtype
+template class RungeKutta<finiteVolume::cellCentred::VolumeField<float>>;
+template class RungeKutta<finiteVolume::cellCentred::VolumeField<double>>;
 }
@@ -10,6 +10,8 @@ namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
 namespace NeoFOAM::timeIntegration
 {
 
-template class ForwardEuler<fvcc::VolumeField<scalar>>;
+// instantiated for both precisions, independent of the precision selected for scalar
+template class ForwardEuler<fvcc::VolumeField<float>>;
+template class ForwardEuler<fvcc::VolumeField<double>>;
 
 } // namespace NeoFOAM::dsl
@@ -3,11 +3,19 @@
 
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
 #include <catch2/catch_session.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_adapters.hpp>
 
 #include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/executor/staging.hpp"
+#include "NeoFOAM/core/executor/threadPool.hpp"
 
 TEST_CASE("Executor Equality")
 {
@@ -30,4 +38,443 @@ TEST_CASE("Executor Equality")
     REQUIRE(gpuExec0 != cpuExec1);
     REQUIRE(gpuExec0 != ompExec1);
     REQUIRE(gpuExec0 == gpuExec1);
+
+    NeoFOAM::Executor poolExec0(NeoFOAM::PoolExecutor {});
+    NeoFOAM::Executor poolExec1(NeoFOAM::PoolExecutor {});
+
+    REQUIRE(poolExec0 != ompExec1);
+    REQUIRE(poolExec0 == poolExec1);
+}
+
+TEST_CASE("AllocationCounter")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
+    );
+    auto& counter = NeoFOAM::AllocationCounter::instance();
+
+    SECTION("disabled by default")
+    {
+        REQUIRE(!counter.enabled());
+        std::visit([](const auto& e) { e.free(e.alloc(64)); }, exec);
+        REQUIRE(counter.total().nAllocations == 0);
+    }
+
+    SECTION("count per label")
+    {
+        counter.setEnabled(true);
+        counter.reset();
+        std::visit(
+            [](const auto& e)
+            {
+                void* field = e.alloc(64);
+                void* buffer = e.alloc(32, "buffer");
+                field = e.realloc(field, 128);
+                e.free(field);
+                e.free(buffer);
+                e.free(nullptr);
+            },
+            exec
+        );
+        counter.setEnabled(false);
+
+        auto field = counter.stats("Field");
+        REQUIRE(field.nAllocations == 2);
+        REQUIRE(field.nFrees == 2);
+        REQUIRE(field.bytesAllocated == 64 + 128);
+        REQUIRE(field.bytesFreed == 64 + 128);
+
+        auto buffer = counter.stats("buffer");
+        REQUIRE(buffer.nAllocations == 1);
+        REQUIRE(buffer.bytesFreed == 32);
+
+        REQUIRE(counter.total().nAllocations == 3);
+        REQUIRE(counter.statsPerLabel().size() == 2);
+    }
+
+    SECTION("count per step")
+    {
+        size_t step = 0;
+        auto steps = NeoFOAM::countAllocations(
+            3,
+            [&]()
+            {
+                // allocate only in the first step
+                if (step++ == 0)
+                {
+                    std::visit([](const auto& e) { e.free(e.alloc(8)); }, exec);
+                }
+            }
+        );
+        REQUIRE(!counter.enabled());
+        REQUIRE(steps.size() == 3);
+        REQUIRE(steps[0].nAllocations == 1);
+        REQUIRE(NeoFOAM::maxAllocationsPerStep(steps) == 1);
+        REQUIRE(NeoFOAM::maxAllocationsPerStep(steps, 1) == 0);
+    }
+    counter.reset();
+}
+
+TEST_CASE("AllocationPolicy")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
+    );
+    auto& counter = NeoFOAM::AllocationCounter::instance();
+    auto isAligned = [](void* ptr, size_t alignment)
+    { return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0; };
+
+    SECTION("64 byte alignment by default")
+    {
+        REQUIRE(NeoFOAM::allocationPolicy(exec).alignment == 64);
+        REQUIRE(NeoFOAM::allocationPolicy(exec).hugePages == NeoFOAM::HugePages::none);
+        std::visit(
+            [&](const auto& e)
+            {
+                void* ptr = e.alloc(1000);
+                REQUIRE(isAligned(ptr, 64));
+                e.free(ptr);
+            },
+            exec
+        );
+    }
+
+    SECTION("larger alignment is kept by realloc")
+    {
+        NeoFOAM::setAllocationPolicy(exec, {.alignment = 4096});
+        counter.setEnabled(true);
+        counter.reset();
+        std::visit(
+            [&](const auto& e)
+            {
+                using ExecutorType = std::remove_cvref_t<decltype(e)>;
+                constexpr bool onHost = Kokkos::SpaceAccessibility<
+                    Kokkos::HostSpace,
+                    typename ExecutorType::exec::memory_space>::accessible;
+                auto* ptr = e.template alloc<int>(100);
+                REQUIRE(isAligned(ptr, 4096));
+                if constexpr (onHost)
+                {
+                    for (int i = 0; i < 100; i++)
+                    {
+                        ptr[i] = i;
+                    }
+                }
+                ptr = e.template realloc<int>(ptr, 10000);
+                REQUIRE(isAligned(ptr, 4096));
+                if constexpr (onHost)
+                {
+                    REQUIRE(ptr[0] == 0);
+                    REQUIRE(ptr[99] == 99);
+                }
+                e.free(ptr);
+            },
+            exec
+        );
+        counter.setEnabled(false);
+        auto stats = counter.total();
+        REQUIRE(stats.nAllocations == 2);
+        REQUIRE(stats.nFrees == 2);
+        REQUIRE(stats.nRealigned <= 2);
+        REQUIRE(stats.nHugePages == 0);
+    }
+
+    SECTION("huge pages above the threshold")
+    {
+        auto hugePages =
+            GENERATE(NeoFOAM::HugePages::transparent, NeoFOAM::HugePages::hugetlbfs);
+        NeoFOAM::setAllocationPolicy(
+            exec, {.hugePages = hugePages, .hugePageThreshold = size_t {1} << 22}
+        );
+        counter.setEnabled(true);
+        counter.reset();
+        const size_t bytes = size_t {1} << 23;
+        std::visit(
+            [&](const auto& e)
+            {
+                e.free(e.alloc(1024));
+                void* ptr = e.alloc(bytes);
+                REQUIRE(isAligned(ptr, 64));
+                e.free(ptr);
+            },
+            exec
+        );
+        counter.setEnabled(false);
+        // whether the kernel provides huge pages depends on its configuration
+        auto stats = counter.total();
+        REQUIRE(stats.nAllocations == 2);
+        REQUIRE(stats.nHugePages <= 1);
+        REQUIRE(stats.bytesHugePages == stats.nHugePages * bytes);
+    }
+
+    SECTION("realloc into huge pages keeps the content")
+    {
+        NeoFOAM::setAllocationPolicy(
+            exec,
+            {.hugePages = NeoFOAM::HugePages::transparent, .hugePageThreshold = size_t {1} << 22}
+        );
+        std::visit(
+            [&](const auto& e)
+            {
+                using ExecutorType = std::remove_cvref_t<decltype(e)>;
+                constexpr bool onHost = Kokkos::SpaceAccessibility<
+                    Kokkos::HostSpace,
+                    typename ExecutorType::exec::memory_space>::accessible;
+                auto* ptr = e.template alloc<int>(100);
+                if constexpr (onHost)
+                {
+                    for (int i = 0; i < 100; i++)
+                    {
+                        ptr[i] = i;
+                    }
+                }
+                ptr = e.template realloc<int>(ptr, size_t {1} << 21);
+                REQUIRE(isAligned(ptr, 64));
+                if constexpr (onHost)
+                {
+                    REQUIRE(ptr[0] == 0);
+                    REQUIRE(ptr[99] == 99);
+                }
+                e.free(ptr);
+            },
+            exec
+        );
+    }
+
+    NeoFOAM::setAllocationPolicy(exec, {});
+    counter.reset();
+}
+
+TEST_CASE("StagingPool")
+{
+    auto& pool = NeoFOAM::StagingPool::instance();
+    pool.release();
+    pool.resetStats();
+
+    SECTION("buffers are reused")
+    {
+        void* data = nullptr;
+        {
+            auto buffer = pool.acquire(10000);
+            REQUIRE(buffer.bytes() == 16384);
+            data = buffer.data();
+        }
+        REQUIRE(pool.stats().bytesCached == 16384);
+        {
+            // a different size rounded to the same capacity
+            auto buffer = pool.acquire(9000);
+            REQUIRE(buffer.data() == data);
+        }
+        REQUIRE(pool.stats().nAllocations == 1);
+        REQUIRE(pool.stats().nReuses == 1);
+    }
+
+    SECTION("release frees the cached buffers")
+    {
+        {
+            auto small = pool.acquire(1);
+            auto large = pool.acquire(1 << 20);
+            REQUIRE(small.bytes() == 4096);
+            REQUIRE(large.bytes() == 1 << 20);
+        }
+        REQUIRE(pool.stats().bytesCached == 4096 + (1 << 20));
+        pool.release();
+        REQUIRE(pool.stats().bytesCached == 0);
+        auto buffer = pool.acquire(1);
+        REQUIRE(pool.stats().nAllocations == 3);
+    }
+}
+
+TEST_CASE("TransferEvent")
+{
+    int nCompleted = 0;
+    {
+        NeoFOAM::TransferEvent event([&nCompleted]() { nCompleted++; });
+        REQUIRE(event.pending());
+        NeoFOAM::TransferEvent moved(std::move(event));
+        REQUIRE(!event.pending());
+        moved.wait();
+        REQUIRE(!moved.pending());
+        REQUIRE(nCompleted == 1);
+
+        // the destructor completes pending transfers
+        NeoFOAM::TransferEvent discarded([&nCompleted]() { nCompleted++; });
+    }
+    REQUIRE(nCompleted == 2);
+}
+
+TEST_CASE("WorkStealingDeque")
+{
+    NeoFOAM::detail::WorkStealingDeque deque;
+
+    SECTION("the owner pops the newest and thieves steal the oldest range")
+    {
+        // more ranges than the initial capacity
+        for (uint32_t i = 0; i < 100; i++)
+        {
+            deque.push({i, i + 1});
+        }
+        REQUIRE(!deque.empty());
+        REQUIRE(deque.steal()->begin == 0);
+        REQUIRE(deque.pop()->begin == 99);
+        REQUIRE(deque.steal()->begin == 1);
+        size_t nTaken = 3;
+        while (deque.pop())
+        {
+            nTaken++;
+        }
+        REQUIRE(nTaken == 100);
+        REQUIRE(deque.empty());
+        REQUIRE(!deque.pop());
+        REQUIRE(!deque.steal());
+    }
+
+    SECTION("every range is taken once while thieves steal")
+    {
+        const uint32_t n = 100000;
+        std::vector<std::atomic<int>> nTaken(n);
+        std::atomic<bool> done {false};
+        std::vector<std::thread> thieves;
+        for (size_t thief = 0; thief < 3; thief++)
+        {
+            thieves.emplace_back(
+                [&]()
+                {
+                    while (!done.load())
+                    {
+                        if (auto range = deque.steal())
+                        {
+                            nTaken[range->begin]++;
+                        }
+                    }
+                }
+            );
+        }
+        for (uint32_t i = 0; i < n; i++)
+        {
+            deque.push({i, i + 1});
+            if (i % 3 == 0)
+            {
+                if (auto range = deque.pop())
+                {
+                    nTaken[range->begin]++;
+                }
+            }
+        }
+        while (auto range = deque.pop())
+        {
+            nTaken[range->begin]++;
+        }
+        done = true;
+        for (auto& thief : thieves)
+        {
+            thief.join();
+        }
+        REQUIRE(std::all_of(
+            nTaken.begin(), nTaken.end(), [](const auto& count) { return count.load() == 1; }
+        ));
+    }
+}
+
+TEST_CASE("ThreadPool")
+{
+    NeoFOAM::detail::ThreadPool pool(4);
+    REQUIRE(pool.size() == 4);
+
+    SECTION("every chunk is processed once")
+    {
+        const size_t nChunks = GENERATE(size_t(1), size_t(3), size_t(1000));
+        std::vector<std::atomic<int>> nProcessed(nChunks);
+        std::atomic<bool> validWorkers {true};
+        const int nLoops = 10;
+        for (int loop = 0; loop < nLoops; loop++)
+        {
+            pool.run(
+                nChunks,
+                [&](size_t first, size_t last, size_t worker)
+                {
+                    validWorkers = validWorkers && worker < 4;
+                    for (size_t chunk = first; chunk < last; chunk++)
+                    {
+                        nProcessed[chunk]++;
+                    }
+                }
+            );
+        }
+        REQUIRE(validWorkers);
+        REQUIRE(std::all_of(
+            nProcessed.begin(),
+            nProcessed.end(),
+            [](const auto& count) { return count.load() == nLoops; }
+        ));
+    }
+
+    SECTION("idle threads steal the chunks of a busy thread")
+    {
+        // the calling thread blocks in the first chunk of its share until another thread processed
+        // a chunk of that share
+        const size_t nChunks = 64;
+        std::atomic<bool> stolen {false};
+        pool.run(
+            nChunks,
+            [&](size_t first, size_t last, size_t worker)
+            {
+                for (size_t chunk = first; chunk < last; chunk++)
+                {
+                    if (chunk < nChunks / 4 && worker != 0)
+                    {
+                        stolen = true;
+                    }
+                    while (chunk == 0 && !stolen)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        );
+        REQUIRE(stolen);
+    }
+
+    SECTION("loops launched within a chunk run on the calling thread")
+    {
+        std::atomic<size_t> nNested {0};
+        std::atomic<bool> sameThread {true};
+        pool.run(
+            8,
+            [&](size_t first, size_t last, size_t)
+            {
+                for (size_t chunk = first; chunk < last; chunk++)
+                {
+                    const auto id = std::this_thread::get_id();
+                    pool.run(
+                        10,
+                        [&](size_t nestedFirst, size_t nestedLast, size_t)
+                        {
+                            sameThread = sameThread && std::this_thread::get_id() == id;
+                            nNested += nestedLast - nestedFirst;
+                        }
+                    );
+                }
+            }
+        );
+        REQUIRE(sameThread);
+        REQUIRE(nNested == 80);
+    }
+
+    SECTION("resize")
+    {
+        pool.resize(2);
+        REQUIRE(pool.size() == 2);
+        std::atomic<size_t> nProcessed {0};
+        pool.run(
+            100, [&](size_t first, size_t last, size_t) { nProcessed += last - first; }
+        );
+        REQUIRE(nProcessed == 100);
+    }
 }
@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/core/kernelGraph.hpp"
+#include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/fields/segmentedField.hpp"
+
+TEST_CASE("KernelGraph")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("replay repeats the captured launches on " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> a(exec, 10, 1.0);
+        NeoFOAM::Field<NeoFOAM::scalar> b(exec, 10, 0.0);
+        auto [sA, sB] = NeoFOAM::spans(a, b);
+
+        NeoFOAM::KernelGraph graph;
+        graph.capture(
+            [&]()
+            {
+                NeoFOAM::parallelFor(
+                    exec, {0, 10}, KOKKOS_LAMBDA(const size_t i) { sB[i] += sA[i]; }, "test::add"
+                );
+                // field overloads and free functions are recorded as well
+                NeoFOAM::parallelFor(
+                    a, KOKKOS_LAMBDA(const size_t i) { return sA[i] * 2.0; }, "test::double"
+                );
+            }
+        );
+        REQUIRE(graph.size() == 2);
+        REQUIRE(graph.replayable());
+        REQUIRE(equal(b, 1.0));
+
+        graph.replay();
+        graph.replay();
+        // b = 1 + 2 + 4, a = 8
+        REQUIRE(equal(b, 7.0));
+        REQUIRE(equal(a, 8.0));
+    }
+
+    SECTION("temporaries are kept alive on " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> result(exec, 10, 0.0);
+        auto sResult = result.span();
+
+        NeoFOAM::KernelGraph graph;
+        graph.capture(
+            [&]()
+            {
+                NeoFOAM::Field<NeoFOAM::scalar> tmp(exec, 10, 3.0);
+                auto sTmp = tmp.span();
+                NeoFOAM::parallelFor(
+                    exec, {0, 10}, KOKKOS_LAMBDA(const size_t i) { sResult[i] += sTmp[i]; }
+                );
+            }
+        );
+        // the fill of the temporary and the addition
+        REQUIRE(graph.size() == 2);
+        graph.replay();
+        REQUIRE(equal(result, 6.0));
+
+        graph.clear();
+        REQUIRE(graph.size() == 0);
+    }
+
+    SECTION("segment loops are recorded on " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::localIdx> segments(exec, std::vector<NeoFOAM::localIdx> {0, 2, 5});
+        NeoFOAM::Field<NeoFOAM::scalar> values(exec, 5, 1.0);
+        NeoFOAM::Field<NeoFOAM::scalar> sums(exec, 2, 0.0);
+        auto sSegments = std::span<const NeoFOAM::localIdx>(segments.span());
+        auto [sValues, sSums] = NeoFOAM::spans(values, sums);
+
+        NeoFOAM::KernelGraph graph;
+        graph.capture(
+            [&]()
+            {
+                NeoFOAM::parallelForSegments(
+                    exec,
+                    sSegments,
+                    KOKKOS_LAMBDA(const size_t, const size_t i) { sValues[i] += 1.0; }
+                );
+                NeoFOAM::parallelReduceSegments(
+                    exec,
+                    sSegments,
+                    KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& acc) { acc += sValues[i]; },
+                    sSums
+                );
+            }
+        );
+        REQUIRE(graph.size() == 2);
+        graph.replay();
+        auto hostSums = sums.copyToHost();
+        REQUIRE(hostSums.span()[0] == 6.0);
+        REQUIRE(hostSums.span()[1] == 9.0);
+    }
+
+    SECTION("reductions can not be replayed on " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> a(exec, 10, 1.0);
+        auto sA = a.span();
+        NeoFOAM::scalar sum = 0.0;
+
+        NeoFOAM::KernelGraph graph;
+        graph.capture(
+            [&]()
+            {
+                NeoFOAM::parallelReduce(
+                    exec,
+                    {0, 10},
+                    KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& acc) { acc += sA[i]; },
+                    sum,
+                    "test::sum"
+                );
+            }
+        );
+        REQUIRE(sum == 10.0);
+        REQUIRE_FALSE(graph.replayable());
+        REQUIRE(graph.unsupported().front() == "test::sum");
+        REQUIRE_THROWS(graph.replay());
+    }
+
+    SECTION("tracked fields are validated on " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> a(exec, 10, 1.0);
+        auto sA = a.span();
+
+        NeoFOAM::KernelGraph graph;
+        graph.capture(
+            [&]() {
+                NeoFOAM::parallelFor(exec, {0, 10}, KOKKOS_LAMBDA(const size_t i) { sA[i] += 1.0; });
+            }
+        );
+        graph.track(a);
+        graph.replay();
+        REQUIRE(equal(a, 3.0));
+
+        a.resize(20);
+        REQUIRE_THROWS(graph.replay());
+    }
+
+    SECTION("memory freed by resizing is kept alive on " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> a(exec, 10, 1.0);
+        NeoFOAM::Field<NeoFOAM::scalar> result(exec, 10, 0.0);
+        auto [sA, sResult] = NeoFOAM::spans(a, result);
+
+        NeoFOAM::KernelGraph graph;
+        graph.capture(
+            [&]()
+            {
+                NeoFOAM::parallelFor(
+                    exec, {0, 10}, KOKKOS_LAMBDA(const size_t i) { sResult[i] += sA[i]; }
+                );
+                // the kernel above keeps reading the old memory of a on replay
+                a.resize(20);
+                NeoFOAM::fill(a, 5.0);
+            }
+        );
+        REQUIRE(a.data() != sA.data());
+        graph.replay();
+        // the old memory of a is unchanged by the fill of the reallocated field
+        REQUIRE(equal(result, 2.0));
+        REQUIRE(equal(a, 5.0));
+    }
+
+    SECTION("captures can not be nested on " + execName)
+    {
+        NeoFOAM::KernelGraph outer;
+        NeoFOAM::KernelGraph inner;
+        REQUIRE_THROWS(outer.capture([&]() { inner.capture([]() {}); }));
+        // the failed capture does not leave a recording behind
+        inner.capture([]() {});
+        REQUIRE(inner.size() == 0);
+    }
+}
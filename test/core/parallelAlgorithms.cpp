@@ -7,20 +7,59 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <Kokkos_Core.hpp>
 
 #include "NeoFOAM/fields/field.hpp"
 #include "NeoFOAM/core/executor/executor.hpp"
 #include "NeoFOAM/core/parallelAlgorithms.hpp"
+#include "NeoFOAM/core/primitives/batch.hpp"
+#include "NeoFOAM/fields/operations/sum.hpp"
 
+template<typename ExecutorType>
+void sumIntoBins(const ExecutorType& exec, size_t n, std::span<NeoFOAM::scalar> bins)
+{
+    const size_t nBins = bins.size();
+    NeoFOAM::parallelFor(
+        exec,
+        {0, n},
+        KOKKOS_LAMBDA(const size_t i) {
+            NeoFOAM::scatterAdd<ExecutorType>(bins[i % nBins], NeoFOAM::scalar(2));
+            NeoFOAM::scatterSub<ExecutorType>(bins[(i + 1) % nBins], NeoFOAM::scalar(1));
+        },
+        "test::sumIntoBins"
+    );
+}
+
+template<typename ExecutorType>
+void scaleInBatches(
+    const ExecutorType& exec,
+    std::span<NeoFOAM::Vector> values,
+    std::span<const NeoFOAM::scalar> factors
+)
+{
+    constexpr size_t width = NeoFOAM::batchWidth<ExecutorType>();
+    NeoFOAM::parallelForBatches<width>(
+        exec,
+        {0, values.size()},
+        KOKKOS_LAMBDA(const size_t first) {
+            auto batch = NeoFOAM::VectorBatch<width>::load(values, first);
+            (batch * NeoFOAM::ScalarBatch<width>::load(factors, first)).store(values, first);
+        },
+        KOKKOS_LAMBDA(const size_t i) { values[i] *= factors[i]; },
+        "test::scaleInBatches"
+    );
+}
 
 TEST_CASE("parallelFor")
 {
     NeoFOAM::Executor exec = GENERATE(
         NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
         NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
-        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
     );
     std::string execName = std::visit([](auto e) { return e.name(); }, exec);
 
@@ -78,6 +117,51 @@ TEST_CASE("parallelFor")
             REQUIRE(value == 3.0);
         }
     }
+
+    SECTION("parallelFor_named_" + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> fieldA(exec, 5);
+        NeoFOAM::fill(fieldA, 1.0, {0, 0}, "test::fill");
+        auto spanA = fieldA.span();
+        NeoFOAM::parallelFor(
+            exec,
+            {0, 5},
+            KOKKOS_LAMBDA(const size_t i) { spanA[i] += 2.0; },
+            "test::parallelFor"
+        );
+        NeoFOAM::localIdx count = 0;
+        NeoFOAM::parallelScan(
+            exec,
+            {0, 5},
+            KOKKOS_LAMBDA(const std::size_t, NeoFOAM::localIdx& update, const bool) {
+                update += 1;
+            },
+            count,
+            "test::parallelScan"
+        );
+        REQUIRE(count == 5);
+        REQUIRE(equal(fieldA, 3.0));
+    }
+
+    SECTION("parallelFor_scatterAdd_" + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> bins(exec, 4, 0.0);
+        auto spanBins = bins.span();
+        std::visit([&](const auto& e) { sumIntoBins(e, 1000, spanBins); }, exec);
+        REQUIRE(equal(bins, 250.0));
+    }
+
+    SECTION("parallelForBatches_" + execName)
+    {
+        // not a multiple of the batch width, so the remainder is processed one by one
+        const size_t n = 19;
+        NeoFOAM::Field<NeoFOAM::Vector> values(exec, n, NeoFOAM::Vector(1.0, 2.0, 3.0));
+        NeoFOAM::Field<NeoFOAM::scalar> factors(exec, n, 2.0);
+        auto spanValues = values.span();
+        auto spanFactors = std::span<const NeoFOAM::scalar>(factors.span());
+        std::visit([&](const auto& e) { scaleInBatches(e, spanValues, spanFactors); }, exec);
+        REQUIRE(equal(values, NeoFOAM::Vector(2.0, 4.0, 6.0)));
+    }
 };
 
 
@@ -86,7 +170,8 @@ TEST_CASE("parallelReduce")
     NeoFOAM::Executor exec = GENERATE(
         NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
         NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
-        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
     );
     std::string execName = std::visit([](auto e) { return e.name(); }, exec);
 
@@ -105,6 +190,29 @@ TEST_CASE("parallelReduce")
         REQUIRE(sum == 5.0);
     }
 
+    SECTION("parallelReduce_overwrites_initial_value_" + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, 5, 1.0);
+        auto span = field.span();
+        // the result does not depend on the value passed in, for all executors
+        NeoFOAM::scalar sum = 42.0;
+        NeoFOAM::parallelReduce(
+            exec,
+            {0, 5},
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += span[i]; },
+            sum
+        );
+        REQUIRE(sum == 5.0);
+
+        NeoFOAM::scalar fieldSum = 42.0;
+        NeoFOAM::parallelReduce(
+            field,
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += span[i]; },
+            fieldSum
+        );
+        REQUIRE(fieldSum == 5.0);
+    }
+
     SECTION("parallelReduce_MaxValue" + execName)
     {
         NeoFOAM::Field<NeoFOAM::scalar> fieldA(exec, 5);
@@ -162,11 +270,255 @@ TEST_CASE("parallelReduce")
     }
 };
 
+TEST_CASE("reproducible parallelReduce")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    // values spanning many orders of magnitude, so that the result depends on the order
+    const size_t size = 10000;
+    NeoFOAM::Field<NeoFOAM::scalar> hostField(NeoFOAM::SerialExecutor {}, size);
+    auto hostSpan = hostField.span();
+    for (size_t i = 0; i < size; i++)
+    {
+        hostSpan[i] = std::pow(-1.3, static_cast<double>(i % 97)) / static_cast<double>(i + 1);
+    }
+    NeoFOAM::Field<NeoFOAM::scalar> field(exec, hostField);
+    auto span = field.span();
+
+    NeoFOAM::scalar reference = 0.0;
+    NeoFOAM::parallelReduce(
+        NeoFOAM::SerialExecutor {},
+        {0, size},
+        [hostSpan](const size_t i, NeoFOAM::scalar& lsum) { lsum += hostSpan[i]; },
+        reference,
+        NeoFOAM::ReduceMode::reproducible
+    );
+
+    SECTION("same bits as serial on " + execName)
+    {
+        // with and without running the blocks inline
+        size_t threshold = GENERATE(size_t(0), size_t(1) << 20);
+        size_t defaultThreshold = NeoFOAM::serialThreshold(exec);
+        NeoFOAM::setSerialThreshold(exec, threshold);
+
+        NeoFOAM::scalar sum = 0.0;
+        NeoFOAM::parallelReduce(
+            exec,
+            {0, size},
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += span[i]; },
+            sum,
+            NeoFOAM::ReduceMode::reproducible
+        );
+        REQUIRE(sum == reference);
+        REQUIRE(NeoFOAM::sum(field, NeoFOAM::ReduceMode::reproducible) == reference);
+
+        NeoFOAM::setSerialThreshold(exec, defaultThreshold);
+    }
+
+    SECTION("global mode on " + execName)
+    {
+        NeoFOAM::setReduceMode(NeoFOAM::ReduceMode::reproducible);
+        NeoFOAM::scalar sum = 0.0;
+        NeoFOAM::parallelReduce(
+            field, KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += span[i]; }, sum
+        );
+        REQUIRE(sum == reference);
+        REQUIRE(NeoFOAM::sum(field) == reference);
+        NeoFOAM::setReduceMode(NeoFOAM::ReduceMode::fast);
+        REQUIRE(NeoFOAM::reduceMode() == NeoFOAM::ReduceMode::fast);
+    }
+
+    SECTION("compensated sum on " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> cancelling(exec, {1.0, 1e100, 1.0, -1e100});
+        REQUIRE(NeoFOAM::sum(cancelling, NeoFOAM::ReduceMode::reproducible) == 2.0);
+    }
+
+    SECTION("reducer on " + execName)
+    {
+        auto max = std::numeric_limits<NeoFOAM::scalar>::max();
+        Kokkos::Max<NeoFOAM::scalar> reducer(max);
+        NeoFOAM::parallelReduce(
+            exec,
+            {0, size},
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lmax) {
+                if (lmax < span[i]) lmax = span[i];
+            },
+            reducer,
+            NeoFOAM::ReduceMode::reproducible
+        );
+        REQUIRE(max == *std::max_element(hostSpan.begin(), hostSpan.end()));
+
+        NeoFOAM::scalar empty = 1.0;
+        NeoFOAM::parallelReduce(
+            exec,
+            {0, 0},
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += span[i]; },
+            empty,
+            NeoFOAM::ReduceMode::reproducible
+        );
+        REQUIRE(empty == 0.0);
+    }
+}
+
+TEST_CASE("serialThreshold")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+    size_t defaultThreshold = NeoFOAM::serialThreshold(exec);
+
+    SECTION("set per executor " + execName)
+    {
+        NeoFOAM::setSerialThreshold(exec, 7);
+        REQUIRE(NeoFOAM::serialThreshold(exec) == 7);
+        REQUIRE(NeoFOAM::serialThreshold(NeoFOAM::SerialExecutor {}) != 7);
+    }
+
+    SECTION("inline and launched kernels agree on " + execName)
+    {
+        // the threshold is either above or below the size of the range
+        size_t threshold = GENERATE(size_t(0), size_t(100));
+        NeoFOAM::setSerialThreshold(exec, threshold);
+
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, 10, 1.0);
+        auto span = field.span();
+        NeoFOAM::parallelFor(
+            exec, {0, 10}, KOKKOS_LAMBDA(const size_t i) { span[i] = static_cast<double>(i); }
+        );
+        auto hostField = field.copyToHost();
+        REQUIRE(hostField.span()[9] == 9.0);
+
+        // like Kokkos, the inline reduction overwrites the initial value
+        NeoFOAM::scalar sum = 1.0;
+        NeoFOAM::parallelReduce(
+            exec,
+            {0, 10},
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += span[i]; },
+            sum
+        );
+        REQUIRE(sum == 45.0);
+
+        auto max = std::numeric_limits<NeoFOAM::scalar>::max();
+        Kokkos::Max<NeoFOAM::scalar> reducer(max);
+        NeoFOAM::parallelReduce(
+            field,
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lmax) {
+                if (lmax < span[i]) lmax = span[i];
+            },
+            reducer
+        );
+        REQUIRE(max == 9.0);
+    }
+
+    SECTION("tune " + execName)
+    {
+        size_t tuned = NeoFOAM::tuneSerialThreshold(exec, 1 << 10);
+        REQUIRE(tuned == NeoFOAM::serialThreshold(exec));
+        REQUIRE(tuned <= (1 << 10));
+    }
+
+    NeoFOAM::setSerialThreshold(exec, defaultThreshold);
+}
+
+TEST_CASE("PoolExecutor")
+{
+    NeoFOAM::PoolExecutor exec {};
+    size_t defaultThreads = NeoFOAM::poolThreads();
+    size_t defaultThreshold = NeoFOAM::serialThreshold(exec);
+    NeoFOAM::setSerialThreshold(exec, 0);
+
+    SECTION("set the number of threads")
+    {
+        NeoFOAM::setPoolThreads(3);
+        REQUIRE(NeoFOAM::poolThreads() == 3);
+    }
+
+    SECTION("irregular kernel")
+    {
+        size_t nThreads = GENERATE(size_t(1), size_t(4));
+        NeoFOAM::setPoolThreads(nThreads);
+
+        // the work per index grows with the index
+        const size_t n = 1000;
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, n, 0.0);
+        auto span = field.span();
+        NeoFOAM::parallelFor(
+            exec,
+            {0, n},
+            KOKKOS_LAMBDA(const size_t i) {
+                NeoFOAM::scalar value = 0.0;
+                for (size_t k = 0; k < i; k++)
+                {
+                    value += 1.0;
+                }
+                span[i] = value;
+            }
+        );
+        NeoFOAM::scalar sum = 0.0;
+        NeoFOAM::parallelReduce(
+            field, KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lsum) { lsum += span[i]; }, sum
+        );
+        REQUIRE(sum == static_cast<NeoFOAM::scalar>(n * (n - 1) / 2));
+
+        auto max = std::numeric_limits<NeoFOAM::scalar>::lowest();
+        Kokkos::Max<NeoFOAM::scalar> reducer(max);
+        NeoFOAM::parallelReduce(
+            exec,
+            {0, n},
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::scalar& lmax) {
+                if (lmax < span[i]) lmax = span[i];
+            },
+            reducer
+        );
+        REQUIRE(max == static_cast<NeoFOAM::scalar>(n - 1));
+
+        NeoFOAM::Field<NeoFOAM::localIdx> offsets(exec, n + 1, 0);
+        auto sOffsets = offsets.span();
+        NeoFOAM::localIdx total = 0;
+        NeoFOAM::parallelScan(
+            exec,
+            {1, n + 1},
+            KOKKOS_LAMBDA(const size_t i, NeoFOAM::localIdx& update, const bool final) {
+                update += static_cast<NeoFOAM::localIdx>(i % 3);
+                if (final)
+                {
+                    sOffsets[i] = update;
+                }
+            },
+            total
+        );
+        NeoFOAM::localIdx expected = 0;
+        bool ordered = true;
+        for (size_t i = 1; i < n + 1; i++)
+        {
+            expected += static_cast<NeoFOAM::localIdx>(i % 3);
+            ordered = ordered && sOffsets[i] == expected;
+        }
+        REQUIRE(ordered);
+        REQUIRE(total == expected);
+    }
+
+    NeoFOAM::setPoolThreads(defaultThreads);
+    NeoFOAM::setSerialThreshold(exec, defaultThreshold);
+}
+
 TEST_CASE("parallelScan")
 {
-    NeoFOAM::Executor exec = GENERATE(NeoFOAM::Executor(NeoFOAM::SerialExecutor {})
-                                      // NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
-                                      // NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        // NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        // NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+        NeoFOAM::Executor(NeoFOAM::PoolExecutor {})
     );
     std::string execName = std::visit([](auto e) { return e.name(); }, exec);
 
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include "NeoFOAM/fields/field.hpp"
+#include "NeoFOAM/core/executor/executor.hpp"
+#include "NeoFOAM/core/parallelPrimitives.hpp"
+
+TEST_CASE("parallelPrimitives")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("sort " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, {3.0, -1.0, 2.0, 2.0, 0.5});
+        NeoFOAM::sort(field);
+        NeoFOAM::Field<NeoFOAM::scalar> expected(exec, {-1.0, 0.5, 2.0, 2.0, 3.0});
+        REQUIRE(equal(field, expected));
+    }
+
+    SECTION("sortByKey " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::label> keys(exec, {4, 1, 3, 0, 2});
+        NeoFOAM::Field<NeoFOAM::scalar> values(exec, {40.0, 10.0, 30.0, 0.0, 20.0});
+        NeoFOAM::sortByKey(keys, values);
+        NeoFOAM::Field<NeoFOAM::label> expectedKeys(exec, {0, 1, 2, 3, 4});
+        NeoFOAM::Field<NeoFOAM::scalar> expectedValues(exec, {0.0, 10.0, 20.0, 30.0, 40.0});
+        REQUIRE(equal(keys, expectedKeys));
+        REQUIRE(equal(values, expectedValues));
+    }
+
+    SECTION("copyIf " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, {3.0, -1.0, 2.0, -2.0, 0.5});
+        auto positive =
+            NeoFOAM::copyIf(field, KOKKOS_LAMBDA(const NeoFOAM::scalar v) { return v > 0.0; });
+        NeoFOAM::Field<NeoFOAM::scalar> expected(exec, {3.0, 2.0, 0.5});
+        REQUIRE(equal(positive, expected));
+
+        auto none =
+            NeoFOAM::copyIf(field, KOKKOS_LAMBDA(const NeoFOAM::scalar v) { return v > 5.0; });
+        REQUIRE(none.size() == 0);
+    }
+
+    SECTION("unique " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::label> field(exec, {0, 0, 1, 3, 3, 3, 4});
+        auto uniqueValues = NeoFOAM::unique(field);
+        NeoFOAM::Field<NeoFOAM::label> expected(exec, {0, 1, 3, 4});
+        REQUIRE(equal(uniqueValues, expected));
+    }
+
+    SECTION("stablePartition " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::label> field(exec, {5, 2, 7, 4, 1, 6});
+        auto nEven = NeoFOAM::stablePartition(
+            field, KOKKOS_LAMBDA(const NeoFOAM::label v) { return v % 2 == 0; }
+        );
+        REQUIRE(nEven == 3);
+        NeoFOAM::Field<NeoFOAM::label> expected(exec, {2, 4, 6, 5, 7, 1});
+        REQUIRE(equal(field, expected));
+    }
+
+    SECTION("histogram " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::label> bins(exec, {2, 0, 2, 3, 2, 0});
+        auto counts = NeoFOAM::histogram(bins, 5);
+        NeoFOAM::Field<NeoFOAM::localIdx> expected(exec, {2, 0, 3, 1, 0});
+        REQUIRE(equal(counts, expected));
+    }
+}
+
+TEST_CASE("parallelScan on the SerialExecutor")
+{
+    NeoFOAM::SerialExecutor exec {};
+    NeoFOAM::Field<NeoFOAM::localIdx> offsets(exec, 4);
+    auto sOffsets = offsets.span();
+    NeoFOAM::localIdx total = 0;
+    NeoFOAM::parallelScan(
+        exec,
+        {0, 4},
+        KOKKOS_LAMBDA(const size_t i, NeoFOAM::localIdx& update, const bool final) {
+            if (final)
+            {
+                sOffsets[i] = update;
+            }
+            update += i + 1;
+        },
+        total
+    );
+    REQUIRE(total == 10);
+    REQUIRE(sOffsets[3] == 6);
+}
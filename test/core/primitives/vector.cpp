@@ -48,4 +48,41 @@ TEST_CASE("Primitives")
             REQUIRE((a + 2 * a + a) == d);
         }
     }
+
+    SECTION("VectorBatch")
+    {
+        std::vector<NeoFOAM::Vector> vectors {
+            {1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}, {1.0, 0.0, 0.0}, {0.0, 3.0, 4.0}
+        };
+        std::vector<NeoFOAM::scalar> scalars {1.0, 2.0, 3.0, 4.0, 5.0};
+        std::vector<NeoFOAM::label> indices {4, 0, 2, 2};
+        std::span<const NeoFOAM::Vector> sVectors(vectors);
+        std::span<const NeoFOAM::label> sIndices(indices);
+
+        auto a = NeoFOAM::VectorBatch<4>::load(sVectors, 1);
+        auto b = NeoFOAM::VectorBatch<4>::gather(sVectors, sIndices, 0);
+        auto s = NeoFOAM::ScalarBatch<4>::load(scalars, 1);
+
+        // each lane agrees with the operations on Vector
+        for (size_t l = 0; l < 4; l++)
+        {
+            const NeoFOAM::Vector va = vectors[l + 1];
+            const NeoFOAM::Vector vb = vectors[static_cast<size_t>(indices[l])];
+            REQUIRE(a[l] == va);
+            REQUIRE(b[l] == vb);
+            REQUIRE((a + b)[l] == va + vb);
+            REQUIRE((a - b)[l] == va - vb);
+            REQUIRE((a * s)[l] == va * scalars[l + 1]);
+            REQUIRE((a * 2.0)[l] == va * 2.0);
+            REQUIRE((a & b)[l] == (va & vb));
+            REQUIRE(mag(b)[l] == NeoFOAM::mag(vb));
+        }
+        REQUIRE(mag(b)[0] == 5.0);
+
+        std::vector<NeoFOAM::Vector> result(5);
+        (a * s).store(result, 1);
+        REQUIRE(result[0] == NeoFOAM::Vector(0.0, 0.0, 0.0));
+        REQUIRE(result[1] == NeoFOAM::Vector(8.0, 10.0, 12.0));
+        REQUIRE(result[4] == NeoFOAM::Vector(0.0, 15.0, 20.0));
+    }
 }
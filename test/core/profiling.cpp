@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2024 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+
+#include "NeoFOAM/core/profiling.hpp"
+
+using NeoFOAM::profiling::Profiler;
+using NeoFOAM::profiling::RegionStats;
+using NeoFOAM::profiling::ScopedTimer;
+
+TEST_CASE("Profiler")
+{
+    Profiler& profiler = Profiler::instance();
+    profiler.reset();
+
+    SECTION("nested regions")
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            ScopedTimer outer("solve");
+            {
+                ScopedTimer inner("div");
+            }
+            ScopedTimer inner("grad");
+        }
+        {
+            ScopedTimer div("div");
+        }
+
+        const auto& stats = profiler.stats();
+        REQUIRE(stats.size() == 4);
+        REQUIRE(stats[0].path == "solve");
+        REQUIRE(stats[0].depth == 0);
+        REQUIRE(stats[0].count == 3);
+        REQUIRE(stats[1].path == "solve/div");
+        REQUIRE(stats[1].name() == "div");
+        REQUIRE(stats[1].depth == 1);
+        REQUIRE(stats[1].count == 3);
+        REQUIRE(stats[2].path == "solve/grad");
+        REQUIRE(stats[3].path == "div");
+        REQUIRE(stats[3].count == 1);
+
+        for (const auto& region : stats)
+        {
+            REQUIRE(region.min <= region.avg());
+            REQUIRE(region.avg() <= region.max);
+        }
+        REQUIRE(stats[0].total >= stats[1].total + stats[2].total);
+
+        std::ostringstream table;
+        profiler.print(table);
+        REQUIRE(table.str().find("  grad") != std::string::npos);
+
+        std::ostringstream json;
+        profiler.writeJson(json);
+        REQUIRE(json.str().find("\"path\": \"solve/div\"") != std::string::npos);
+    }
+
+    SECTION("fenced regions")
+    {
+        profiler.setFence(true);
+        {
+            ScopedTimer timer("fenced");
+        }
+        profiler.setFence(false);
+        REQUIRE(profiler.stats()[0].count == 1);
+    }
+
+    SECTION("serialize")
+    {
+        std::vector<RegionStats> stats {
+            {"solve", 0, 2, 1.5, 0.5, 1.0}, {"solve/div", 1, 2, 1.0, 0.25, 0.75}
+        };
+        auto restored = Profiler::deserialize(Profiler::serialize(stats));
+        REQUIRE(restored.size() == 2);
+        REQUIRE(restored[1].path == "solve/div");
+        REQUIRE(restored[1].depth == 1);
+        REQUIRE(restored[1].count == 2);
+        REQUIRE(restored[1].total == 1.0);
+        REQUIRE(restored[1].min == 0.25);
+        REQUIRE(restored[1].max == 0.75);
+    }
+
+    SECTION("merge ranks")
+    {
+        std::vector<RegionStats> rank0 {
+            {"solve", 0, 2, 2.0, 1.0, 1.0}, {"solve/comm", 1, 1, 1.0, 1.0, 1.0}
+        };
+        std::vector<RegionStats> rank1 {{"solve", 0, 2, 4.0, 2.0, 2.0}};
+        auto merged = Profiler::merge({rank0, rank1});
+
+        REQUIRE(merged.size() == 2);
+        REQUIRE(merged[0].path == "solve");
+        REQUIRE(merged[0].nRanks == 2);
+        REQUIRE(merged[0].count == 4);
+        REQUIRE(merged[0].minTotal == 2.0);
+        REQUIRE(merged[0].avgTotal == 3.0);
+        REQUIRE(merged[0].maxTotal == 4.0);
+
+        REQUIRE(merged[1].nRanks == 1);
+        REQUIRE(merged[1].minTotal == 0.0);
+        REQUIRE(merged[1].avgTotal == 0.5);
+        REQUIRE(merged[1].maxTotal == 1.0);
+
+        std::ostringstream table;
+        Profiler::print(merged, table);
+        REQUIRE(table.str().find("  comm") != std::string::npos);
+    }
+
+    profiler.reset();
+}
@@ -13,7 +13,7 @@ namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
 
 using Field = NeoFOAM::Field<NeoFOAM::scalar>;
 using Coeff = NeoFOAM::dsl::Coeff;
-using Operator = NeoFOAM::dsl::Operator;
+using Operator = NeoFOAM::dsl::Operator<NeoFOAM::scalar>;
 using Executor = NeoFOAM::Executor;
 using VolumeField = fvcc::VolumeField<NeoFOAM::scalar>;
 using OperatorMixin = NeoFOAM::dsl::OperatorMixin<VolumeField>;
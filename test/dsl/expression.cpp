@@ -5,7 +5,7 @@
 #include "common.hpp"
 #include "NeoFOAM/NeoFOAM.hpp"
 
-using Expression = NeoFOAM::dsl::Expression;
+using Expression = NeoFOAM::dsl::Expression<NeoFOAM::scalar>;
 
 TEST_CASE("Expression")
 {
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "NeoFOAM/fields/comparison.hpp"
+
+TEST_CASE("Field comparison")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    NeoFOAM::Field<NeoFOAM::scalar> a(exec, {1.0, 2.0, 3.0, 4.0});
+    NeoFOAM::Field<NeoFOAM::scalar> b(exec, {1.0, 2.5, 3.0, 3.9});
+
+    SECTION("equal " + execName)
+    {
+        REQUIRE(equal(a, a));
+        REQUIRE(!equal(a, b));
+        REQUIRE(equal(a, NeoFOAM::Field<NeoFOAM::scalar>(NeoFOAM::SerialExecutor {}, a)));
+        REQUIRE(!equal(a, NeoFOAM::Field<NeoFOAM::scalar>(exec, 3, 1.0)));
+        REQUIRE(equal(NeoFOAM::Field<NeoFOAM::scalar>(exec, 3, 1.0), 1.0));
+        REQUIRE(!equal(a, 1.0));
+    }
+
+    SECTION("maxDeviation " + execName)
+    {
+        auto deviation = NeoFOAM::maxDeviation(a, b);
+        REQUIRE(deviation.value == 0.5);
+        REQUIRE(deviation.index == 1);
+
+        auto none = NeoFOAM::maxDeviation(a, a);
+        REQUIRE(none.value == 0.0);
+
+        // NaNs are the largest deviation, equal deviations report the first index
+        const NeoFOAM::scalar qNaN = std::numeric_limits<NeoFOAM::scalar>::quiet_NaN();
+        NeoFOAM::Field<NeoFOAM::scalar> nan(exec, {1.0, 2.0, qNaN, qNaN});
+        auto nanDeviation = NeoFOAM::maxDeviation(nan, a);
+        REQUIRE(nanDeviation.value == std::numeric_limits<NeoFOAM::scalar>::infinity());
+        REQUIRE(nanDeviation.index == 2);
+    }
+
+    SECTION("allClose " + execName)
+    {
+        REQUIRE(NeoFOAM::allClose(a, b, 0.5));
+        REQUIRE(!NeoFOAM::allClose(a, b, 0.1));
+        REQUIRE(NeoFOAM::allClose(a, b, 0.0, 0.2));
+
+        NeoFOAM::Field<NeoFOAM::scalar> nan(
+            exec, {1.0, std::numeric_limits<NeoFOAM::scalar>::quiet_NaN(), 3.0, 4.0}
+        );
+        REQUIRE(!NeoFOAM::allClose(a, nan, 1.0));
+    }
+
+    SECTION("maxUlpDistance " + execName)
+    {
+        REQUIRE(NeoFOAM::maxUlpDistance(a, a) == 0);
+
+        const NeoFOAM::scalar x = 1.0;
+        const NeoFOAM::scalar next = std::nextafter(x, 2.0);
+        const NeoFOAM::scalar prev = std::nextafter(x, 0.0);
+        NeoFOAM::Field<NeoFOAM::scalar> c(exec, {x, -0.0, next, -1.0});
+        NeoFOAM::Field<NeoFOAM::scalar> d(exec, {prev, 0.0, prev, -1.0});
+        REQUIRE(NeoFOAM::maxUlpDistance(c, d) == 2);
+
+        // the smallest values of both signs are two steps apart
+        const NeoFOAM::scalar tiny = std::numeric_limits<NeoFOAM::scalar>::denorm_min();
+        NeoFOAM::Field<NeoFOAM::scalar> e(exec, std::vector<NeoFOAM::scalar> {tiny});
+        NeoFOAM::Field<NeoFOAM::scalar> f(exec, std::vector<NeoFOAM::scalar> {-tiny});
+        REQUIRE(NeoFOAM::maxUlpDistance(e, f) == 2);
+    }
+
+    SECTION("checksum " + execName)
+    {
+        const auto sum = NeoFOAM::checksum(a);
+        REQUIRE(sum == NeoFOAM::checksum(NeoFOAM::Field<NeoFOAM::scalar>(exec, a)));
+        REQUIRE(
+            sum == NeoFOAM::checksum(NeoFOAM::Field<NeoFOAM::scalar>(NeoFOAM::SerialExecutor {}, a))
+        );
+        REQUIRE(sum != NeoFOAM::checksum(b));
+
+        // swapping values changes the checksum
+        NeoFOAM::Field<NeoFOAM::scalar> swapped(exec, {2.0, 1.0, 3.0, 4.0});
+        REQUIRE(sum != NeoFOAM::checksum(swapped));
+
+        NeoFOAM::Field<NeoFOAM::Vector> vectors(exec, 3, NeoFOAM::Vector(1.0, 2.0, 3.0));
+        NeoFOAM::Field<NeoFOAM::Vector> shorter(exec, 2, NeoFOAM::Vector(1.0, 2.0, 3.0));
+        REQUIRE(NeoFOAM::checksum(vectors) != NeoFOAM::checksum(shorter));
+    }
+}
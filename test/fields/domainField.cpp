@@ -46,4 +46,42 @@ TEST_CASE("Boundaries")
         NeoFOAM::fill(bCs.valueFraction(), 2.0);
         REQUIRE(equal(bCs.valueFraction(), 2.0));
     }
+
+    SECTION("boundaryFields_from_offsets_" + execName)
+    {
+        std::vector<NeoFOAM::localIdx> offsets {0, 2, 5, 9};
+        NeoFOAM::BoundaryFields<double> bCs(exec, offsets);
+
+        REQUIRE(bCs.nBoundaries() == 3);
+        REQUIRE(bCs.nBoundaryFaces() == 9);
+        REQUIRE(bCs.range(1) == std::pair<NeoFOAM::localIdx, NeoFOAM::localIdx> {2, 5});
+
+        NeoFOAM::fill(bCs.value(), 2.0);
+
+        SECTION("patchSum")
+        {
+            auto hostSum = NeoFOAM::patchSum(bCs).copyToHost();
+            REQUIRE(hostSum[0] == 4.0);
+            REQUIRE(hostSum[1] == 6.0);
+            REQUIRE(hostSum[2] == 8.0);
+        }
+
+        SECTION("patchIntegrate")
+        {
+            NeoFOAM::Field<NeoFOAM::Vector> sf(exec, 9, NeoFOAM::Vector(1.0, 0.0, 0.5));
+            auto hostForce = NeoFOAM::patchIntegrate(bCs, sf).copyToHost();
+            REQUIRE(hostForce[0] == NeoFOAM::Vector(4.0, 0.0, 2.0));
+            REQUIRE(hostForce[1] == NeoFOAM::Vector(6.0, 0.0, 3.0));
+            REQUIRE(hostForce[2] == NeoFOAM::Vector(8.0, 0.0, 4.0));
+        }
+    }
+
+    SECTION("boundaryFields_from_empty_offsets_" + execName)
+    {
+        NeoFOAM::BoundaryFields<double> bCs(exec, std::vector<NeoFOAM::localIdx> {});
+
+        REQUIRE(bCs.nBoundaries() == 0);
+        REQUIRE(bCs.nBoundaryFaces() == 0);
+        REQUIRE(NeoFOAM::patchSum(bCs).size() == 0);
+    }
 }
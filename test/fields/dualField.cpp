@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include "NeoFOAM/fields/boundaryFields.hpp"
+#include "NeoFOAM/fields/dualField.hpp"
+
+TEST_CASE("DualField")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("host data is synchronised " + execName)
+    {
+        NeoFOAM::DualField<NeoFOAM::scalar> dual(exec, std::vector<NeoFOAM::scalar> {1.0, 2.0});
+        REQUIRE(!dual.needSyncHost());
+        REQUIRE(!dual.needSyncDevice());
+        REQUIRE(dual.hostSpan()[1] == 2.0);
+        auto hostField = dual.field().copyToHost();
+        REQUIRE(hostField.span()[0] == dual.hostSpan()[0]);
+    }
+
+    SECTION("device modifications reach the host " + execName)
+    {
+        NeoFOAM::DualField<NeoFOAM::scalar> dual(exec, 3);
+        NeoFOAM::fill(dual.field(), 4.0);
+        dual.modifyDevice();
+        REQUIRE(dual.needSyncHost() == !dual.sharesMemory());
+        dual.syncHost();
+        REQUIRE(!dual.needSyncHost());
+        REQUIRE(dual.hostSpan()[2] == 4.0);
+    }
+
+    SECTION("host modifications reach the device " + execName)
+    {
+        NeoFOAM::DualField<NeoFOAM::scalar> dual(exec, 3);
+        NeoFOAM::fill(dual.field(), 0.0);
+        dual.modifyDevice();
+        dual.syncHost();
+        dual.hostSpan()[1] = 5.0;
+        dual.modifyHost();
+        REQUIRE(dual.needSyncDevice() == !dual.sharesMemory());
+        dual.syncDevice();
+        REQUIRE(!dual.needSyncDevice());
+        auto hostField = dual.field().copyToHost();
+        REQUIRE(hostField.span()[1] == 5.0);
+    }
+
+    SECTION("from a field " + execName)
+    {
+        NeoFOAM::DualField<NeoFOAM::scalar> dual(NeoFOAM::Field<NeoFOAM::scalar>(exec, 2, 7.0));
+        dual.syncHost();
+        REQUIRE(dual.hostSpan()[0] == 7.0);
+
+        NeoFOAM::DualField<NeoFOAM::scalar> copy(NeoFOAM::SerialExecutor {}, dual);
+        REQUIRE(copy.sharesMemory());
+        REQUIRE(copy.hostSpan()[1] == 7.0);
+    }
+
+    SECTION("boundary ranges are read from the host mirror " + execName)
+    {
+        NeoFOAM::BoundaryFields<NeoFOAM::scalar> bFields(
+            exec, std::vector<NeoFOAM::localIdx> {0, 3, 5}
+        );
+        REQUIRE(bFields.range(1) == std::pair<NeoFOAM::localIdx, NeoFOAM::localIdx> {3, 5});
+
+        NeoFOAM::BoundaryFields<NeoFOAM::scalar> copy(NeoFOAM::SerialExecutor {}, bFields);
+        REQUIRE(copy.range(0) == std::pair<NeoFOAM::localIdx, NeoFOAM::localIdx> {0, 3});
+    }
+}
@@ -264,6 +264,65 @@ TEST_CASE("Field Operations")
     }
 }
 
+TEST_CASE("Masks")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    NeoFOAM::Field<NeoFOAM::scalar> a(exec, {-2.0, 1.0, 3.0, -1.0, 5.0});
+    auto positive = NeoFOAM::mask(a, KOKKOS_LAMBDA(const NeoFOAM::scalar v) { return v > 0.0; });
+
+    SECTION("mask and count " + execName)
+    {
+        REQUIRE(positive.size() == a.size());
+        auto hostMask = positive.copyToHost();
+        REQUIRE(!hostMask.span()[0]);
+        REQUIRE(hostMask.span()[4]);
+        REQUIRE(NeoFOAM::count(positive) == 3);
+    }
+
+    SECTION("where " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> b(exec, a.size(), 10.0);
+        auto selected = NeoFOAM::where(positive, a, b);
+        NeoFOAM::Field<NeoFOAM::scalar> expected(exec, {10.0, 1.0, 3.0, 10.0, 5.0});
+        REQUIRE(equal(selected, expected));
+
+        // clip the negative values
+        auto clipped = NeoFOAM::where(positive, a, 0.0);
+        NeoFOAM::Field<NeoFOAM::scalar> expectedClipped(exec, {0.0, 1.0, 3.0, 0.0, 5.0});
+        REQUIRE(equal(clipped, expectedClipped));
+    }
+
+    SECTION("masked fill and map " + execName)
+    {
+        NeoFOAM::fill(a, 0.0, positive);
+        NeoFOAM::Field<NeoFOAM::scalar> expectedFill(exec, {-2.0, 0.0, 0.0, -1.0, 0.0});
+        REQUIRE(equal(a, expectedFill));
+
+        NeoFOAM::map(a, KOKKOS_LAMBDA(const size_t i) { return static_cast<double>(i); }, positive);
+        NeoFOAM::Field<NeoFOAM::scalar> expectedMap(exec, {-2.0, 1.0, 2.0, -1.0, 4.0});
+        REQUIRE(equal(a, expectedMap));
+    }
+
+    SECTION("masked sum " + execName)
+    {
+        REQUIRE(NeoFOAM::sum(a, positive) == 9.0);
+        REQUIRE(NeoFOAM::sum(a, positive, NeoFOAM::ReduceMode::reproducible) == 9.0);
+    }
+
+    SECTION("mismatching sizes " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> b(exec, a.size() + 1, 1.0);
+        REQUIRE_THROWS(NeoFOAM::fill(b, 0.0, positive));
+    }
+}
+
 TEST_CASE("getSpans")
 {
     NeoFOAM::Executor exec = GENERATE(
@@ -294,3 +353,137 @@ TEST_CASE("getSpans")
         REQUIRE(value == 5.0);
     }
 }
+
+TEST_CASE("NumaPolicy")
+{
+    auto policy = GENERATE(
+        NeoFOAM::NumaPolicy::none, NeoFOAM::NumaPolicy::firstTouch, NeoFOAM::NumaPolicy::interleave
+    );
+    REQUIRE(NeoFOAM::numaPolicy() == NeoFOAM::NumaPolicy::firstTouch);
+    NeoFOAM::setNumaPolicy(policy);
+
+    NeoFOAM::CPUExecutor exec {};
+    const size_t size = 1 << 18;
+    std::vector<NeoFOAM::scalar> values(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        values[i] = static_cast<NeoFOAM::scalar>(i);
+    }
+
+    SECTION("placing the pages keeps the data")
+    {
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, values);
+        NeoFOAM::Field<NeoFOAM::scalar> copy = field.copyToExecutor(NeoFOAM::SerialExecutor {})
+                                                   .copyToExecutor(exec);
+        auto hostField = copy.copyToHost();
+        REQUIRE(hostField.span()[0] == 0.0);
+        REQUIRE(hostField.span()[size - 1] == static_cast<NeoFOAM::scalar>(size - 1));
+
+        // every page is either reported on a node or as unplaced, e.g. without NUMA support
+        auto placement = NeoFOAM::pagePlacement(copy);
+        REQUIRE(placement.nPages >= size * sizeof(NeoFOAM::scalar) / 4096);
+        size_t nPlaced = 0;
+        for (auto nPages : placement.pagesPerNode)
+        {
+            nPlaced += nPages;
+        }
+        REQUIRE(nPlaced + placement.nUnplaced == placement.nPages);
+    }
+
+    SECTION("only allocations above the threshold are placed")
+    {
+        // a filled vector reports its pages on a node only if the system supports the query
+        auto supported = NeoFOAM::pagePlacement(values.data(), size * sizeof(NeoFOAM::scalar));
+        const size_t bytes = size_t(1) << 22;
+
+        // both buffers are alive at the same time, so the second can not reuse touched pages
+        NeoFOAM::setNumaThreshold(bytes + 1);
+        void* small = exec.alloc(bytes);
+        NeoFOAM::setNumaThreshold(size_t(1) << 20);
+        void* large = exec.alloc(bytes);
+        auto smallPlacement = NeoFOAM::pagePlacement(small, bytes);
+        auto largePlacement = NeoFOAM::pagePlacement(large, bytes);
+        exec.free(small);
+        exec.free(large);
+
+        if (supported.nUnplaced < supported.nPages)
+        {
+            // fresh pages are only mapped once they are touched, the allocator may reuse a few
+            REQUIRE(smallPlacement.nUnplaced > smallPlacement.nPages / 2);
+            if (policy == NeoFOAM::NumaPolicy::none)
+            {
+                REQUIRE(largePlacement.nUnplaced > largePlacement.nPages / 2);
+            }
+            else
+            {
+                REQUIRE(largePlacement.nUnplaced == 0);
+            }
+        }
+    }
+
+    SECTION("empty memory spans no pages")
+    {
+        REQUIRE(NeoFOAM::pagePlacement(nullptr, 0).nPages == 0);
+        NeoFOAM::Field<NeoFOAM::scalar> field(exec, 0);
+        REQUIRE(NeoFOAM::pagePlacement(field).nPages == 0);
+    }
+
+    NeoFOAM::setNumaPolicy(NeoFOAM::NumaPolicy::firstTouch);
+}
+
+TEST_CASE("copyAsync")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    const size_t size = 1000;
+    NeoFOAM::Field<NeoFOAM::scalar> field(exec, size, 2.0);
+    NeoFOAM::Field<NeoFOAM::scalar> hostField(NeoFOAM::SerialExecutor {}, size, 0.0);
+
+    SECTION("to a host field " + execName)
+    {
+        auto event = NeoFOAM::copyAsync(field, hostField);
+        event.wait();
+        REQUIRE(!event.pending());
+        REQUIRE(hostField[0] == 2.0);
+        REQUIRE(hostField[size - 1] == 2.0);
+    }
+
+    SECTION("back from a host field " + execName)
+    {
+        NeoFOAM::fill(hostField, 3.0);
+        NeoFOAM::copyAsync(hostField, field).wait();
+        REQUIRE(field.copyToHost()[size - 1] == 3.0);
+    }
+
+    SECTION("repeated copies do not allocate " + execName)
+    {
+        auto& pool = NeoFOAM::StagingPool::instance();
+        NeoFOAM::copyAsync(field, hostField).wait();
+        pool.resetStats();
+        auto& counter = NeoFOAM::AllocationCounter::instance();
+        counter.setEnabled(true);
+        counter.reset();
+        for (int step = 0; step < 10; step++)
+        {
+            NeoFOAM::copyAsync(field, hostField).wait();
+        }
+        counter.setEnabled(false);
+        REQUIRE(counter.total().nAllocations == 0);
+        REQUIRE(pool.stats().nAllocations == 0);
+    }
+
+    SECTION("prefetch " + execName)
+    {
+        auto pending = NeoFOAM::prefetch(hostField, exec);
+        NeoFOAM::Field<NeoFOAM::scalar>& prefetched = pending.get();
+        REQUIRE(!pending.pending());
+        REQUIRE(prefetched.exec() == exec);
+        REQUIRE(prefetched.copyToHost()[0] == 0.0);
+    }
+}
@@ -9,6 +9,7 @@
 
 #include "NeoFOAM/fields/segmentedField.hpp"
 #include "NeoFOAM/core/primitives/label.hpp"
+#include "NeoFOAM/core/primitives/vector.hpp"
 #include <Kokkos_Core.hpp>
 
 TEST_CASE("segmentedField")
@@ -156,5 +157,115 @@ TEST_CASE("segmentedField")
             REQUIRE(hostResult[3] == 3 * 4);
             REQUIRE(hostResult[4] == 4 * 5);
         }
+
+        SECTION("segmented reduce")
+        {
+            auto segView = segField.view();
+            parallelFor(
+                exec,
+                {0, segField.size()},
+                KOKKOS_LAMBDA(const size_t i) { segView.values[i] = i; }
+            );
+
+            NeoFOAM::Field<NeoFOAM::label> result(exec, segField.numSegments());
+            NeoFOAM::segmentedReduce(
+                exec,
+                segView,
+                KOKKOS_LAMBDA(const size_t i, NeoFOAM::label& acc) { acc += segView.values[i]; },
+                result.span()
+            );
+
+            auto hostResult = result.copyToHost();
+            REQUIRE(hostResult[0] == 0);
+            REQUIRE(hostResult[1] == 1 + 2);
+            REQUIRE(hostResult[2] == 3 + 4 + 5);
+            REQUIRE(hostResult[3] == 6 + 7 + 8 + 9);
+            REQUIRE(hostResult[4] == 10 + 11 + 12 + 13 + 14);
+        }
+
+        SECTION("team per segment")
+        {
+            auto segView = segField.view();
+            NeoFOAM::parallelForSegments(
+                exec,
+                segView,
+                KOKKOS_LAMBDA(const size_t segI, const size_t i) {
+                    segView.values[i] = static_cast<NeoFOAM::label>(segI * i);
+                }
+            );
+
+            NeoFOAM::Field<NeoFOAM::label> result(exec, segField.numSegments());
+            NeoFOAM::parallelReduceSegments(
+                exec,
+                segView,
+                KOKKOS_LAMBDA(const size_t i, NeoFOAM::label& acc) { acc += segView.values[i]; },
+                result.span()
+            );
+
+            auto hostResult = result.copyToHost();
+            REQUIRE(hostResult[0] == 0);
+            REQUIRE(hostResult[1] == 1 * (1 + 2));
+            REQUIRE(hostResult[2] == 2 * (3 + 4 + 5));
+            REQUIRE(hostResult[3] == 3 * (6 + 7 + 8 + 9));
+            REQUIRE(hostResult[4] == 4 * (10 + 11 + 12 + 13 + 14));
+        }
+
+        SECTION("team, thread and vector levels")
+        {
+            auto segments = std::span<const NeoFOAM::localIdx>(segField.view().segments);
+            NeoFOAM::Field<NeoFOAM::Vector> vectors(exec, segField.size());
+            auto sVectors = vectors.span();
+            NeoFOAM::parallelForSegments(
+                exec,
+                segments,
+                3,
+                KOKKOS_LAMBDA(const size_t segI, const size_t i, const size_t j) {
+                    sVectors[i][j] = static_cast<NeoFOAM::scalar>(segI * i + j);
+                }
+            );
+
+            NeoFOAM::Field<NeoFOAM::Vector> result(exec, segField.numSegments());
+            NeoFOAM::parallelReduceSegments(
+                exec,
+                segments,
+                3,
+                KOKKOS_LAMBDA(const size_t i, const size_t j, NeoFOAM::Vector& acc) {
+                    acc[j] += sVectors[i][j];
+                },
+                result.span()
+            );
+
+            // the components of segment segI sum up to segI * sum(i) + j * nEntries
+            auto hostResult = result.copyToHost();
+            REQUIRE(hostResult[0] == NeoFOAM::Vector(0.0, 1.0, 2.0));
+            REQUIRE(hostResult[2] == NeoFOAM::Vector(24.0, 27.0, 30.0));
+            REQUIRE(hostResult[4] == NeoFOAM::Vector(240.0, 245.0, 250.0));
+        }
+    }
+
+    SECTION("Constructor from unsorted pairs " + execName)
+    {
+        NeoFOAM::Field<NeoFOAM::localIdx> keys(exec, {2, 0, 2, 3, 0, 2});
+        NeoFOAM::Field<NeoFOAM::label> values(exec, {5, 1, 3, 7, 0, 4});
+        NeoFOAM::SegmentedField<NeoFOAM::label, NeoFOAM::localIdx> segField(keys, values, 4, true);
+
+        REQUIRE(segField.size() == 6);
+        REQUIRE(segField.numSegments() == 4);
+        auto hostSegments = segField.segments().copyToHost();
+        REQUIRE(hostSegments[0] == 0);
+        REQUIRE(hostSegments[1] == 2);
+        REQUIRE(hostSegments[2] == 2);
+        REQUIRE(hostSegments[3] == 5);
+        REQUIRE(hostSegments[4] == 6);
+
+        NeoFOAM::Field<NeoFOAM::label> expected(exec, {0, 1, 3, 4, 5, 7});
+        REQUIRE(equal(segField.values(), expected));
+
+        SECTION("unsorted")
+        {
+            NeoFOAM::SegmentedField<NeoFOAM::label, NeoFOAM::localIdx> unsorted(keys, values, 4);
+            NeoFOAM::sortSegments(unsorted);
+            REQUIRE(equal(unsorted.values(), expected));
+        }
     }
 }
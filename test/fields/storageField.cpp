@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include "NeoFOAM/fields/storageField.hpp"
+
+template<typename ValueSpan>
+void scale(NeoFOAM::Field<NeoFOAM::scalar>& result, ValueSpan values, NeoFOAM::scalar factor)
+{
+    NeoFOAM::parallelFor(result, KOKKOS_LAMBDA(const size_t i) { return factor * values[i]; });
+}
+
+TEST_CASE("StorageField")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    const NeoFOAM::scalar third = 1.0 / 3.0;
+    NeoFOAM::Field<NeoFOAM::scalar> values(exec, {third, 2 * third, 1.0, 4.0});
+
+    SECTION("Full precision " + execName)
+    {
+        NeoFOAM::StorageField<NeoFOAM::scalar> storage(values);
+
+        REQUIRE(storage.precision() == NeoFOAM::Precision::full);
+        REQUIRE(storage.size() == 4);
+        REQUIRE(storage.bytes() == 4 * sizeof(NeoFOAM::scalar));
+
+        auto hostWidened = storage.widen().copyToHost();
+        REQUIRE(hostWidened[0] == third);
+    }
+
+    SECTION("Reduced precision " + execName)
+    {
+        NeoFOAM::StorageField<NeoFOAM::scalar> storage(values, NeoFOAM::Precision::reduced);
+
+        REQUIRE(storage.precision() == NeoFOAM::Precision::reduced);
+        REQUIRE(storage.size() == 4);
+        REQUIRE(storage.bytes() == 4 * sizeof(NeoFOAM::ReducedType<NeoFOAM::scalar>));
+
+        auto hostWidened = storage.widen().copyToHost();
+        for (size_t i = 0; i < 4; i++)
+        {
+            REQUIRE(
+                hostWidened[i] == static_cast<NeoFOAM::ReducedType<NeoFOAM::scalar>>(values.copyToHost()[i])
+            );
+        }
+        // integers are stored exactly
+        REQUIRE(hostWidened[3] == 4.0);
+    }
+
+    SECTION("Kernels compute in full precision " + execName)
+    {
+        NeoFOAM::StorageField<NeoFOAM::scalar> storage(values, NeoFOAM::Precision::reduced);
+        NeoFOAM::Field<NeoFOAM::scalar> result(exec, storage.size());
+
+        storage.visit([&](auto span) { scale(result, span, third); });
+
+        auto hostResult = result.copyToHost();
+        // the product is not rounded to float
+        REQUIRE(hostResult[3] == 4.0 * third);
+    }
+
+    SECTION("Change precision " + execName)
+    {
+        NeoFOAM::StorageField<NeoFOAM::scalar> storage(values, NeoFOAM::Precision::reduced);
+
+        storage.setPrecision(NeoFOAM::Precision::full);
+        REQUIRE(storage.precision() == NeoFOAM::Precision::full);
+        // the values rounded before are not restored
+        REQUIRE(
+            storage.widen().copyToHost()[0]
+            == static_cast<NeoFOAM::ReducedType<NeoFOAM::scalar>>(third)
+        );
+
+        storage.assign(values);
+        REQUIRE(storage.widen().copyToHost()[0] == third);
+    }
+}
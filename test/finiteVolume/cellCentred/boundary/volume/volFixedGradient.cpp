@@ -88,5 +88,63 @@ TEST_CASE("fixedGradient")
                 REQUIRE(boundaryValue == 6.0);
             }
         }
+
+        SECTION("FixedGradient_10 on a patch with offset")
+        {
+            NeoFOAM::scalar setValue {10};
+            NeoFOAM::Dictionary dict;
+            dict.insert("fixedGradient", setValue);
+            auto boundary =
+                NeoFOAM::finiteVolume::cellCentred::VolumeBoundaryFactory<NeoFOAM::scalar>::create(
+                    "fixedGradient", mesh, dict, 3
+                );
+
+            boundary->correctBoundaryCondition(domainField);
+
+            auto values = domainField.boundaryField().value().copyToHost();
+
+            for (auto& boundaryValue : values.span(boundary->range()))
+            {
+                REQUIRE(boundaryValue == 6.0);
+            }
+            // the other patches are untouched
+            REQUIRE(values.span()[0] == -1.0);
+        }
+    }
+
+    SECTION("FixedGradient in both precisions " + execName)
+    {
+        auto mesh = NeoFOAM::createSingleCellMesh(exec);
+        NeoFOAM::DomainField<float> floatField(exec, mesh);
+        NeoFOAM::DomainField<double> doubleField(exec, mesh);
+        NeoFOAM::fill(floatField.internalField(), 1.0f);
+        NeoFOAM::fill(doubleField.internalField(), 1.0);
+
+        NeoFOAM::Dictionary floatDict;
+        floatDict.insert("fixedGradient", 10.0f);
+        NeoFOAM::Dictionary doubleDict;
+        doubleDict.insert("fixedGradient", 10.0);
+        auto floatBoundary =
+            NeoFOAM::finiteVolume::cellCentred::VolumeBoundaryFactory<float>::create(
+                "fixedGradient", mesh, floatDict, 0
+            );
+        auto doubleBoundary =
+            NeoFOAM::finiteVolume::cellCentred::VolumeBoundaryFactory<double>::create(
+                "fixedGradient", mesh, doubleDict, 0
+            );
+
+        floatBoundary->correctBoundaryCondition(floatField);
+        doubleBoundary->correctBoundaryCondition(doubleField);
+
+        auto floatValues = floatField.boundaryField().value().copyToHost();
+        auto doubleValues = doubleField.boundaryField().value().copyToHost();
+        for (auto boundaryValue : floatValues.span(floatBoundary->range()))
+        {
+            REQUIRE(boundaryValue == 6.0f);
+        }
+        for (auto boundaryValue : doubleValues.span(doubleBoundary->range()))
+        {
+            REQUIRE(boundaryValue == 6.0);
+        }
     }
 }
@@ -12,6 +12,9 @@
 using NeoFOAM::finiteVolume::cellCentred::SurfaceInterpolation;
 using NeoFOAM::finiteVolume::cellCentred::VolumeField;
 using NeoFOAM::finiteVolume::cellCentred::SurfaceField;
+using NeoFOAM::finiteVolume::cellCentred::VolumeBoundary;
+using NeoFOAM::finiteVolume::cellCentred::SurfaceBoundary;
+using NeoFOAM::finiteVolume::cellCentred::createCalculatedBCs;
 
 TEST_CASE("linear")
 {
@@ -24,8 +27,49 @@ TEST_CASE("linear")
     std::string execName = std::visit([](auto e) { return e.name(); }, exec);
     auto mesh = NeoFOAM::createSingleCellMesh(exec);
     NeoFOAM::Input input = NeoFOAM::TokenList({std::string("linear")});
-    auto linear = SurfaceInterpolation(exec, mesh, input);
+    auto linear = SurfaceInterpolation<NeoFOAM::scalar>(exec, mesh, input);
 
     auto in = VolumeField<NeoFOAM::scalar>(exec, "in", mesh, {});
     auto out = SurfaceField<NeoFOAM::scalar>(exec, "out", mesh, {});
+
+    SECTION("Reduced precision weights " + execName)
+    {
+        auto mesh1D = NeoFOAM::create1DUniformMesh(exec, 10);
+        auto linear1D = SurfaceInterpolation<NeoFOAM::scalar>(exec, mesh1D, input);
+        auto geometryScheme =
+            NeoFOAM::finiteVolume::cellCentred::GeometryScheme::readOrCreate(mesh1D);
+
+        auto phi = VolumeField<NeoFOAM::scalar>(
+            exec,
+            "phi",
+            mesh1D,
+            createCalculatedBCs<VolumeBoundary<NeoFOAM::scalar>>(mesh1D)
+        );
+        NeoFOAM::fill(phi.boundaryField().value(), 1.0);
+        auto sPhi = phi.internalField().span();
+        NeoFOAM::parallelFor(
+            exec,
+            {0, sPhi.size()},
+            KOKKOS_LAMBDA(const size_t celli) { sPhi[celli] = 1.0 / (1.0 + celli); }
+        );
+        auto full = SurfaceField<NeoFOAM::scalar>(
+            exec, "full", mesh1D, createCalculatedBCs<SurfaceBoundary<NeoFOAM::scalar>>(mesh1D)
+        );
+        auto reduced = SurfaceField<NeoFOAM::scalar>(
+            exec, "reduced", mesh1D, createCalculatedBCs<SurfaceBoundary<NeoFOAM::scalar>>(mesh1D)
+        );
+
+        linear1D.interpolate(phi, full);
+        geometryScheme->setWeightsPrecision(NeoFOAM::Precision::reduced);
+        REQUIRE(geometryScheme->weightsPrecision() == NeoFOAM::Precision::reduced);
+        linear1D.interpolate(phi, reduced);
+        geometryScheme->setWeightsPrecision(NeoFOAM::Precision::full);
+
+        auto hostFull = full.internalField().copyToHost();
+        auto hostReduced = reduced.internalField().copyToHost();
+        for (size_t facei = 0; facei < hostFull.size(); facei++)
+        {
+            REQUIRE(std::abs(hostReduced[facei] - hostFull[facei]) < 1e-7);
+        }
+    }
 }
@@ -11,7 +11,7 @@
 
 namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
 
-using Operator = NeoFOAM::dsl::Operator;
+using Operator = NeoFOAM::dsl::Operator<NeoFOAM::scalar>;
 
 TEST_CASE("DivOperator")
 {
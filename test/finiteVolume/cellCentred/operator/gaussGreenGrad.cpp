@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2025 NeoFOAM authors
+
+#define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
+                            // a custom main
+#include <catch2/catch_session.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_all.hpp>
+
+#include "NeoFOAM/NeoFOAM.hpp"
+#include "NeoFOAM/finiteVolume/cellCentred/operators/gaussGreenGrad.hpp"
+
+namespace fvcc = NeoFOAM::finiteVolume::cellCentred;
+
+TEST_CASE("GaussGreenGrad")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("gradient of a linear field " + execName)
+    {
+        // the number of cells is not a multiple of the batch width of the host executors
+        const size_t nCells = 21;
+        auto mesh = NeoFOAM::create1DUniformMesh(exec, nCells);
+
+        auto volumeBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoFOAM::scalar>>(mesh);
+        fvcc::VolumeField<NeoFOAM::scalar> phi(exec, "phi", mesh, volumeBCs);
+        auto sPhi = phi.internalField().span();
+        const auto sC = mesh.cellCentres().span();
+        NeoFOAM::parallelFor(
+            exec, {0, nCells}, KOKKOS_LAMBDA(const size_t celli) { sPhi[celli] = sC[celli][0]; }
+        );
+        // the values at the left and right boundary face
+        NeoFOAM::Field<NeoFOAM::scalar> boundaryValues(exec, {0.0, 1.0});
+        phi.boundaryField().value() = boundaryValues;
+
+        auto vectorBCs = fvcc::createCalculatedBCs<fvcc::VolumeBoundary<NeoFOAM::Vector>>(mesh);
+        fvcc::VolumeField<NeoFOAM::Vector> gradPhi(exec, "gradPhi", mesh, vectorBCs);
+        NeoFOAM::fill(gradPhi.internalField(), NeoFOAM::Vector(0.0, 0.0, 0.0));
+
+        fvcc::GaussGreenGrad(exec, mesh).grad(phi, gradPhi);
+
+        auto hostGradPhi = gradPhi.internalField().copyToHost();
+        for (size_t celli = 0; celli < nCells; celli++)
+        {
+            REQUIRE(NeoFOAM::mag(hostGradPhi[celli] - NeoFOAM::Vector(1.0, 0.0, 0.0)) < 1e-12);
+        }
+    }
+}
@@ -36,4 +36,22 @@ TEST_CASE("LinearSystem")
     REQUIRE(linearSystem.matrix().nRows() == 3);
 
     REQUIRE(linearSystem.rhs().size() == 3);
+
+    SECTION("convert to single precision " + execName)
+    {
+        auto floatSystem = NeoFOAM::la::convert<float>(linearSystem);
+
+        REQUIRE(floatSystem.exec() == exec);
+        REQUIRE(floatSystem.matrix().nNonZeros() == 9);
+        REQUIRE(floatSystem.matrix().nRows() == 3);
+        REQUIRE(floatSystem.rhs().size() == 3);
+
+        auto hostMatrix = floatSystem.matrix().copyToHost();
+        for (size_t i = 0; i < 9; i++)
+        {
+            REQUIRE(hostMatrix.values()[i] == static_cast<float>(i + 1));
+            REQUIRE(hostMatrix.colIdxs()[i] == static_cast<NeoFOAM::localIdx>(i % 3));
+        }
+        REQUIRE(hostMatrix.rowPtrs()[3] == 9);
+    }
 }
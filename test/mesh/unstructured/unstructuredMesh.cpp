@@ -10,6 +10,14 @@
 #include "NeoFOAM/mesh/unstructured/unstructuredMesh.hpp"
 #include "NeoFOAM/fields/domainField.hpp"
 
+template<typename ValueSpan>
+NeoFOAM::Field<NeoFOAM::scalar> widen(const NeoFOAM::Executor& exec, ValueSpan values)
+{
+    NeoFOAM::Field<NeoFOAM::scalar> result(exec, values.size());
+    NeoFOAM::parallelFor(result, KOKKOS_LAMBDA(const size_t i) { return values[i]; });
+    return result;
+}
+
 TEST_CASE("Unstructured Mesh")
 {
     NeoFOAM::Executor exec = GENERATE(
@@ -94,4 +102,78 @@ TEST_CASE("Unstructured Mesh")
         REQUIRE(hostBoundaryDelta[0][0] == -0.125);
         REQUIRE(hostBoundaryDelta[1][0] == 0.125);
     }
+
+    SECTION("Can create a 3D uniform mesh " + execName)
+    {
+        NeoFOAM::UnstructuredMesh mesh = NeoFOAM::create3DUniformMesh(exec, 4, 3, 2);
+
+        REQUIRE(mesh.nCells() == 24);
+        REQUIRE(mesh.nInternalFaces() == 3 * 3 * 2 + 4 * 2 * 2 + 4 * 3 * 1);
+        REQUIRE(mesh.nBoundaryFaces() == 2 * (3 * 2 + 4 * 2 + 4 * 3));
+        REQUIRE(mesh.nBoundaries() == 6);
+        REQUIRE(mesh.nFaces() == mesh.nInternalFaces() + mesh.nBoundaryFaces());
+        REQUIRE(mesh.points().size() == 5 * 4 * 3);
+
+        auto offset = mesh.boundaryMesh().offset();
+        REQUIRE(offset.size() == 7);
+        REQUIRE(offset[1] - offset[0] == 3 * 2);
+        REQUIRE(offset[3] - offset[2] == 4 * 2);
+        REQUIRE(offset[6] - offset[5] == 4 * 3);
+
+        auto cellCentres = mesh.cellCentres().copyToHost();
+        REQUIRE(NeoFOAM::mag(cellCentres[0] - NeoFOAM::Vector(0.125, 1.0 / 6.0, 0.25)) < 1e-12);
+        REQUIRE(NeoFOAM::mag(cellCentres[23] - NeoFOAM::Vector(0.875, 5.0 / 6.0, 0.75)) < 1e-12);
+
+        // the face area vectors of each cell sum to zero and the volumes to the unit cube
+        auto owner = mesh.faceOwner().copyToHost();
+        auto neighbour = mesh.faceNeighbour().copyToHost();
+        auto sf = mesh.faceAreas().copyToHost();
+        std::vector<NeoFOAM::Vector> closure(mesh.nCells(), NeoFOAM::Vector(0, 0, 0));
+        for (size_t facei = 0; facei < mesh.nFaces(); facei++)
+        {
+            closure[static_cast<size_t>(owner[facei])] += sf[facei];
+            if (facei < mesh.nInternalFaces())
+            {
+                closure[static_cast<size_t>(neighbour[facei])] -= sf[facei];
+            }
+        }
+        for (const auto& sum : closure)
+        {
+            REQUIRE(NeoFOAM::mag(sum) < 1e-12);
+        }
+        auto volumes = mesh.cellVolumes().copyToHost();
+        NeoFOAM::scalar totalVolume = 0.0;
+        for (size_t celli = 0; celli < mesh.nCells(); celli++)
+        {
+            totalVolume += volumes[celli];
+        }
+        REQUIRE(std::abs(totalVolume - 1.0) < 1e-12);
+    }
+
+    SECTION("Can read the geometry in reduced precision " + execName)
+    {
+        NeoFOAM::UnstructuredMesh mesh = NeoFOAM::create3DUniformMesh(exec, 4, 3, 2);
+        REQUIRE(mesh.precision(NeoFOAM::GeometryArray::cellVolumes) == NeoFOAM::Precision::full);
+
+        mesh.setPrecision(NeoFOAM::GeometryArray::cellVolumes, NeoFOAM::Precision::reduced);
+        REQUIRE(mesh.precision(NeoFOAM::GeometryArray::cellVolumes) == NeoFOAM::Precision::reduced);
+        REQUIRE(mesh.precision(NeoFOAM::GeometryArray::magFaceAreas) == NeoFOAM::Precision::full);
+
+        auto volumes = mesh.cellVolumes().copyToHost();
+        auto reduced = mesh.visitCellVolumes([&](auto V) { return widen(exec, V); }).copyToHost();
+        REQUIRE(reduced.size() == mesh.nCells());
+        for (size_t celli = 0; celli < mesh.nCells(); celli++)
+        {
+            REQUIRE(std::abs(reduced[celli] - volumes[celli]) < 1e-7 * volumes[celli]);
+        }
+        if constexpr (!std::is_same_v<NeoFOAM::ReducedType<NeoFOAM::scalar>, NeoFOAM::scalar>)
+        {
+            // 1/24 is not representable, the reduced values are rounded
+            REQUIRE(reduced[0] != volumes[0]);
+        }
+
+        mesh.setPrecision(NeoFOAM::GeometryArray::cellVolumes, NeoFOAM::Precision::full);
+        auto full = mesh.visitCellVolumes([&](auto V) { return widen(exec, V); }).copyToHost();
+        REQUIRE(full[0] == volumes[0]);
+    }
 }
@@ -3,6 +3,8 @@
 
 #define CATCH_CONFIG_RUNNER // Define this before including catch.hpp to create
                             // a custom main
+#include <cmath>
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/generators/catch_generators_all.hpp>
 
@@ -13,20 +15,21 @@
 // only needed for msvc
 template class NeoFOAM::timeIntegration::ForwardEuler<VolumeField>;
 
-struct CreateField
+template<typename ValueType>
+struct CreateTypedField
 {
     std::string name;
     const NeoFOAM::UnstructuredMesh& mesh;
-    NeoFOAM::scalar value = 0;
+    ValueType value = 0;
     std::int64_t timeIndex = 0;
     std::int64_t iterationIndex = 0;
     std::int64_t subCycleIndex = 0;
+    std::vector<fvcc::VolumeBoundary<ValueType>> bcs {};
 
     NeoFOAM::Document operator()(NeoFOAM::Database& db)
     {
-        std::vector<fvcc::VolumeBoundary<NeoFOAM::scalar>> bcs {};
-        NeoFOAM::Field<NeoFOAM::scalar> internalField(mesh.exec(), mesh.nCells(), value);
-        fvcc::VolumeField<NeoFOAM::scalar> vf(
+        NeoFOAM::Field<ValueType> internalField(mesh.exec(), mesh.nCells(), value);
+        fvcc::VolumeField<ValueType> vf(
             mesh.exec(), name, mesh, internalField, bcs, db, "", ""
         );
         return NeoFOAM::Document(
@@ -40,6 +43,86 @@ struct CreateField
     }
 };
 
+using CreateField = CreateTypedField<NeoFOAM::scalar>;
+
+/* advect an inlet value through a 1D mesh, computing in the precision of ValueType, and if replay
+ * is set capture the second time step in a KernelGraph and replay it for the remaining steps */
+template<typename ValueType>
+std::vector<double> advect(const NeoFOAM::Executor& exec, size_t nSteps, bool replay = false)
+{
+    auto mesh = NeoFOAM::create1DUniformMesh(exec, 10);
+    NeoFOAM::Database db;
+    fvcc::FieldCollection& fieldCollection = fvcc::FieldCollection::instance(db, "fieldCollection");
+
+    // the boundary values are stored with the value type of the field
+    NeoFOAM::Dictionary inlet;
+    inlet.insert("type", std::string("fixedValue"));
+    inlet.insert("fixedValue", ValueType(1));
+    NeoFOAM::Dictionary outlet;
+    outlet.insert("type", std::string("fixedGradient"));
+    outlet.insert("fixedGradient", ValueType(0));
+    fvcc::VolumeField<ValueType>& T =
+        fieldCollection.registerField<fvcc::VolumeField<ValueType>>(CreateTypedField<ValueType> {
+            .name = "T",
+            .mesh = mesh,
+            .bcs = {
+                fvcc::VolumeBoundary<ValueType>(mesh, inlet, 0),
+                fvcc::VolumeBoundary<ValueType>(mesh, outlet, 1)
+            }
+        });
+    T.correctBoundaryConditions();
+
+    // the face fluxes stay in scalar precision
+    fvcc::SurfaceField<NeoFOAM::scalar> phi(
+        exec, "phi", mesh, fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoFOAM::scalar>>(mesh)
+    );
+    NeoFOAM::fill(phi.internalField(), 1.0);
+
+    NeoFOAM::Dictionary fvSchemes;
+    NeoFOAM::Dictionary ddtSchemes;
+    ddtSchemes.insert("type", std::string("forwardEuler"));
+    fvSchemes.insert("ddtSchemes", ddtSchemes);
+    NeoFOAM::Dictionary divSchemes;
+    divSchemes.insert(
+        "div(phi,T)", NeoFOAM::TokenList({std::string("Gauss"), std::string("linear")})
+    );
+    fvSchemes.insert("divSchemes", divSchemes);
+    NeoFOAM::Dictionary fvSolution;
+
+    NeoFOAM::dsl::Expression<ValueType> eqn =
+        NeoFOAM::dsl::temporal::ddt(T) + NeoFOAM::dsl::exp::div(phi, T);
+    NeoFOAM::scalar dt {0.01};
+    NeoFOAM::scalar time {0.0};
+    NeoFOAM::KernelGraph graph;
+    for (size_t step = 0; step < nSteps; step++)
+    {
+        // the first step sets up the old time field, which is not replayed
+        if (replay && step == 1)
+        {
+            graph.capture([&]() { NeoFOAM::dsl::solve(eqn, T, time, dt, fvSchemes, fvSolution); });
+            graph.track(T.internalField());
+            REQUIRE(graph.replayable());
+        }
+        else if (replay && step > 1)
+        {
+            graph.replay();
+        }
+        else
+        {
+            NeoFOAM::dsl::solve(eqn, T, time, dt, fvSchemes, fvSolution);
+        }
+        time += dt;
+    }
+
+    auto hostT = T.internalField().copyToHost();
+    std::vector<double> result;
+    for (const auto value : hostT.span())
+    {
+        result.push_back(static_cast<double>(value));
+    }
+    return result;
+}
+
 TEST_CASE("TimeIntegration")
 {
     NeoFOAM::Executor exec = GENERATE(
@@ -82,4 +165,121 @@ TEST_CASE("TimeIntegration")
         NeoFOAM::dsl::solve(eqn, vf, time, dt, fvSchemes, fvSolution);
         REQUIRE(getField(vf.internalField()) == -2.0);
     }
+
+    SECTION("Allocations per time step on " + execName)
+    {
+        auto dummy = Dummy(vf);
+        Operator ddtOperator = NeoFOAM::dsl::temporal::ddt(vf);
+        auto eqn = ddtOperator + dummy;
+        double dt {2.0};
+        double time {1.0};
+
+        auto steps = NeoFOAM::countAllocations(
+            5, [&]() { NeoFOAM::dsl::solve(eqn, vf, time, dt, fvSchemes, fvSolution); }
+        );
+        // the first step sets up the old time field, afterwards only the explicit source and
+        // the temporaries of the update remain
+        REQUIRE(NeoFOAM::maxAllocationsPerStep(steps, 1) <= 4);
+        REQUIRE(steps.back().nFrees == steps.back().nAllocations);
+    }
+
+    SECTION("Allocations per time step with a div operator on " + execName)
+    {
+        // advection on a 1D mesh, with an inlet on the left and zero gradient on the right
+        auto mesh1D = NeoFOAM::create1DUniformMesh(exec, 10);
+        NeoFOAM::Dictionary inlet;
+        inlet.insert("type", std::string("fixedValue"));
+        inlet.insert("fixedValue", 1.0);
+        NeoFOAM::Dictionary outlet;
+        outlet.insert("type", std::string("fixedGradient"));
+        outlet.insert("fixedGradient", 0.0);
+        fvcc::VolumeField<NeoFOAM::scalar>& T =
+            fieldCollection.registerField<fvcc::VolumeField<NeoFOAM::scalar>>(CreateField {
+                .name = "T",
+                .mesh = mesh1D,
+                .bcs = {
+                    fvcc::VolumeBoundary<NeoFOAM::scalar>(mesh1D, inlet, 0),
+                    fvcc::VolumeBoundary<NeoFOAM::scalar>(mesh1D, outlet, 1)
+                }
+            });
+        T.correctBoundaryConditions();
+
+        fvcc::SurfaceField<NeoFOAM::scalar> phi(
+            exec,
+            "phi",
+            mesh1D,
+            fvcc::createCalculatedBCs<fvcc::SurfaceBoundary<NeoFOAM::scalar>>(mesh1D)
+        );
+        NeoFOAM::fill(phi.internalField(), 1.0);
+
+        NeoFOAM::Dictionary divSchemes;
+        divSchemes.insert(
+            "div(phi,T)", NeoFOAM::TokenList({std::string("Gauss"), std::string("linear")})
+        );
+        fvSchemes.insert("divSchemes", divSchemes);
+
+        auto eqn = NeoFOAM::dsl::temporal::ddt(T) + NeoFOAM::dsl::exp::div(phi, T);
+        double dt {0.01};
+        double time {0.0};
+
+        auto steps = NeoFOAM::countAllocations(
+            5,
+            [&]()
+            {
+                NeoFOAM::dsl::solve(eqn, T, time, dt, fvSchemes, fvSolution);
+                time += dt;
+            }
+        );
+        // on top of the 4 allocations of the step above, the div operator allocates its temporary
+        // SurfaceField of interpolated values, with internal and boundary fields, every step
+        REQUIRE(NeoFOAM::maxAllocationsPerStep(steps, 1) <= 19);
+        REQUIRE(steps.back().nFrees == steps.back().nAllocations);
+    }
+}
+
+TEST_CASE("TimeIntegration in float and double")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("ForwardEuler with a div operator gives the same result in both precisions on "
+            + execName)
+    {
+        auto resultFloat = advect<float>(exec, 10);
+        auto resultDouble = advect<double>(exec, 10);
+
+        REQUIRE(resultFloat.size() == resultDouble.size());
+        // the boundary values have changed the solution
+        REQUIRE(std::abs(resultDouble[0]) > 0.1);
+        for (size_t celli = 0; celli < resultDouble.size(); celli++)
+        {
+            REQUIRE(std::abs(resultFloat[celli] - resultDouble[celli]) < 1e-5);
+        }
+    }
+}
+
+TEST_CASE("TimeIntegration replayed from a KernelGraph")
+{
+    NeoFOAM::Executor exec = GENERATE(
+        NeoFOAM::Executor(NeoFOAM::SerialExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::CPUExecutor {}),
+        NeoFOAM::Executor(NeoFOAM::GPUExecutor {})
+    );
+
+    std::string execName = std::visit([](auto e) { return e.name(); }, exec);
+
+    SECTION("replaying a ForwardEuler step with a div operator equals solving on " + execName)
+    {
+        auto solved = advect<NeoFOAM::scalar>(exec, 10);
+        auto replayed = advect<NeoFOAM::scalar>(exec, 10, true);
+
+        REQUIRE(std::abs(solved[0]) > 0.1);
+        // the same kernels are launched in the same order
+        REQUIRE(replayed == solved);
+    }
 }